@@ -0,0 +1,200 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "lepong/Attribute.h"
+
+namespace lepong::Batch
+{
+
+// Many headless matches stepped together with a fixed time step.<br>
+// The state is stored as one array per value (structure of arrays) so a step is a few tight loops over
+// contiguous floats. The ball, paddle and scoring rules are Match's, evaluated in the same order, but the loop around
+// them is not:<br>
+// - Every tick lasts skTickDelta, a Match ticks with the frame's delta.<br>
+// - The ball is served on the tick after a point, a Match waits for the space key.<br>
+// - Each match serves from its own random state, a Match from the game's shared generator.<br>
+// - A match reaching skWinningScore clears its scores and plays on, a Match reports its end and waits to be started.
+
+enum class Action : std::uint8_t
+{
+    None,
+    Up,
+    Down
+};
+
+static constexpr float skTickDelta = 1.0f / 120.0f;
+
+// A match ends when a player reaches this score, then it starts over.
+static constexpr std::uint32_t skWinningScore = 11u;
+
+// Paddles only move vertically.
+static constexpr float skPaddle1PositionX = 50.0f;
+static constexpr float skPaddle2PositionX = 1280.0f - 50.0f;
+
+// Arrays are padded to whole cache lines.
+static constexpr unsigned skArrayAlignment = 64u;
+
+///
+/// The pages backing large arrays, see SetArrayPages.
+///
+enum class Pages : unsigned
+{
+    // Whatever the heap uses.
+    Normal,
+
+    // Regular pages the kernel is asked to merge into transparent huge pages, Linux only.
+    Transparent,
+
+    // Reserved huge pages: MAP_HUGETLB on Linux, large pages on Windows, which needs the lock pages privilege.
+    Huge,
+
+    Count
+};
+
+// Arrays smaller than a huge page always come from the heap.
+static constexpr std::size_t skMinPagedSize = 2u << 20u;
+
+///
+/// What an agent sees of a match, in the order the values are written to an observation.<br>
+/// Positions are in terrain units.
+///
+enum class Observation : unsigned
+{
+    BallPositionX,
+    BallPositionY,
+    BallDirectionX,
+    BallDirectionY,
+    BallSpeed,
+    Paddle1PositionY,
+    Paddle2PositionY,
+
+    // 1 once the ball is served, 0 right after a point.
+    Playing,
+
+    Count
+};
+
+// The number of floats per match in an observation array.
+static constexpr unsigned skObservationSize = static_cast<unsigned>(Observation::Count);
+
+struct Batch
+{
+    unsigned numMatches = 0u;
+
+    // Ball.
+    float* ballPositionsX = nullptr;
+    float* ballPositionsY = nullptr;
+    float* ballDirectionsX = nullptr;
+    float* ballDirectionsY = nullptr;
+    float* ballSpeeds = nullptr;
+
+    // Paddles only move vertically, at a fixed speed.
+    float* paddle1PositionsY = nullptr;
+    float* paddle1Directions = nullptr;
+    float* paddle2PositionsY = nullptr;
+    float* paddle2Directions = nullptr;
+
+    std::uint32_t* player1Scores = nullptr;
+    std::uint32_t* player2Scores = nullptr;
+    std::uint32_t* playing = nullptr;
+    std::uint32_t* randomStates = nullptr;
+
+    // Statistics.
+    std::uint64_t numSteps = 0u;
+    std::uint64_t numFinishedMatches = 0u;
+
+    void* memory = nullptr;
+
+public:
+    LEPONG_NODISCARD constexpr bool IsValid() const noexcept
+    {
+        return memory;
+    }
+};
+
+///
+/// \return The number of elements a batch array has for the provided number of matches.
+///
+LEPONG_NODISCARD constexpr std::size_t GetArraySize(unsigned numMatches) noexcept
+{
+    constexpr auto kElementsPerLine = skArrayAlignment / sizeof(float);
+    return (numMatches + kElementsPerLine - 1u) / kElementsPerLine * kElementsPerLine;
+}
+
+///
+/// Allocates memory for batch arrays, aligned to skArrayAlignment.
+///
+/// \return The allocated memory or nullptr on failure.
+///
+LEPONG_NODISCARD void* AllocateArrays(std::size_t size) noexcept;
+
+///
+/// Frees memory allocated with AllocateArrays.
+///
+void FreeArrays(void* memory) noexcept;
+
+///
+/// Sets the pages AllocateArrays tries first for arrays of at least skMinPagedSize bytes, normal pages by default.<br>
+/// Pages that can't be had fall back to the next smaller kind: huge pages to transparent ones, those to the heap.
+///
+void SetArrayPages(Pages pages) noexcept;
+
+///
+/// \return The number of bytes currently allocated with the provided pages.
+///
+LEPONG_NODISCARD std::uint64_t GetArrayBytes(Pages pages) noexcept;
+
+///
+/// Sets whether the steps use the SSE2 code where it is available, the default, or the scalar code everywhere.<br>
+/// Both give the same results, lepong_batchbench --check compares them.
+///
+void SetVectorized(bool vectorized) noexcept;
+
+///
+/// Creates a batch of matches ready to be served. Every match gets its own random state derived from the seed.
+///
+LEPONG_NODISCARD Batch MakeBatch(unsigned numMatches, std::uint32_t seed) noexcept;
+
+///
+/// Destroys the provided batch.<br>
+/// If the provided batch is not valid, this function does nothing.
+///
+void DestroyBatch(Batch& batch) noexcept;
+
+///
+/// Advances every match by skTickDelta.<br>
+/// Balls are served automatically, any action array can be nullptr for no action.
+///
+void Step(Batch& batch, const Action* player1Actions, const Action* player2Actions) noexcept;
+
+///
+/// Advances every match by <i>numTicks</i> ticks with the same actions, then observes the matches once.<br>
+/// An agent makes one decision per call: the intermediate ticks only simulate, they are not observed.
+///
+/// \param rewards Player 1's reward for each match, the points it won minus the points it lost during the ticks.
+/// Player 2's reward is the opposite. Can be nullptr.
+/// \param observations Filled like <i>Observe</i> after the last tick. Can be nullptr.
+///
+void StepRepeated(
+    Batch& batch, const Action* player1Actions, const Action* player2Actions, unsigned numTicks,
+    float* rewards, float* observations) noexcept;
+
+///
+/// Writes an observation of every match, skObservationSize floats per match.
+///
+/// \param observations At least <code>numMatches * skObservationSize</code> floats, match after match.
+///
+void Observe(const Batch& batch, float* observations) noexcept;
+
+///
+/// Fills both action arrays with a simple policy that follows the ball.
+///
+void ComputeTrackingActions(const Batch& batch, Action* player1Actions, Action* player2Actions) noexcept;
+
+} // namespace lepong::Batch
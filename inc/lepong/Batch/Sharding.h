@@ -0,0 +1,108 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "Batch.h"
+#include "Topology.h"
+
+namespace lepong::Batch
+{
+
+// Splits matches into one shard per worker thread, with the workers spread evenly across the NUMA nodes.<br>
+// Each worker pins itself to the processors of its node, then creates its own shard: the shard's memory is first
+// touched, hence placed, on the node that steps it. Workers step their shard with the tracking policy until stopped,
+// collecting rewards and observations like a training loop would.<br>
+// On a host with a single node, nothing is pinned and the workers are plain threads.
+
+struct Shard
+{
+    // The index of the node in the topology.
+    unsigned node = 0u;
+
+    unsigned numMatches = 0u;
+    std::uint32_t seed = 0u;
+
+    // Written by the worker, read once it is joined.
+    bool pinned = false;
+    bool allocated = false;
+
+    std::uint64_t numDecisions = 0u;
+    std::uint64_t numTicks = 0u;
+    std::uint64_t numFinishedMatches = 0u;
+
+    // In nanoseconds, from the first decision to the last.
+    std::uint64_t elapsed = 0u;
+};
+
+struct ShardedBatch
+{
+    Topology topology;
+    unsigned actionRepeat = 1u;
+
+    unsigned numShards = 0u;
+    Shard* shards = nullptr;
+    std::thread* workers = nullptr;
+
+    std::atomic<bool> stopping = false;
+
+public:
+    LEPONG_NODISCARD bool IsValid() const noexcept
+    {
+        return workers;
+    }
+};
+
+///
+/// Per node totals of a stopped sharded batch.
+///
+struct NodeThroughput
+{
+    unsigned numWorkers = 0u;
+    unsigned numMatches = 0u;
+
+    double matchDecisionsPerSecond = 0.0;
+    double matchTicksPerSecond = 0.0;
+    std::uint64_t numFinishedMatches = 0u;
+
+    // Whether every worker of the node was pinned and allocated its shard.
+    bool pinned = true;
+    bool allocated = true;
+};
+
+///
+/// Queries the topology, then starts the workers.
+///
+/// \param batch The batch to start, it is not movable.
+/// \param workersPerNode The number of workers on each node, 0 for one per processor of the node.
+/// \param actionRepeat The number of ticks per decision, see StepRepeated.
+///
+/// \return Whether every worker was started.
+///
+LEPONG_NODISCARD bool StartShardedBatch(
+    ShardedBatch& batch, unsigned numMatches, std::uint32_t seed, unsigned workersPerNode,
+    unsigned actionRepeat) noexcept;
+
+///
+/// Stops and joins the workers, their shards are destroyed but their statistics are kept until the batch is destroyed.
+///
+void StopShardedBatch(ShardedBatch& batch) noexcept;
+
+///
+/// Destroys a stopped sharded batch.
+///
+void DestroyShardedBatch(ShardedBatch& batch) noexcept;
+
+///
+/// \param node The index of a node in the batch's topology.
+///
+/// \return The totals of the shards of the provided node.
+///
+LEPONG_NODISCARD NodeThroughput GetNodeThroughput(const ShardedBatch& batch, unsigned node) noexcept;
+
+} // namespace lepong::Batch
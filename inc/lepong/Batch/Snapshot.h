@@ -0,0 +1,82 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "lepong/Attribute.h"
+
+#include "Batch.h"
+
+namespace lepong::Batch
+{
+
+// Lets one thread look at a batch while another one steps it.<br>
+// The simulation thread publishes copies of what is needed to draw the matches into a triple buffer: publishing and
+// acquiring never wait on each other, the reader always gets the latest complete snapshot.
+
+struct Snapshot
+{
+    float* ballPositionsX = nullptr;
+    float* ballPositionsY = nullptr;
+    float* paddle1PositionsY = nullptr;
+    float* paddle2PositionsY = nullptr;
+
+    std::uint32_t* player1Scores = nullptr;
+    std::uint32_t* player2Scores = nullptr;
+
+    // The batch's step count when the snapshot was published.
+    std::uint64_t step = 0u;
+};
+
+struct SnapshotExchange
+{
+    unsigned numMatches = 0u;
+
+    Snapshot snapshots[3];
+
+    // The snapshot the writer is filling and the one the reader is looking at. The third one is in the middle index,
+    // which is the only state shared by both threads.
+    unsigned writeIndex = 0u;
+    unsigned readIndex = 1u;
+    std::atomic<unsigned> middleIndex = 2u;
+
+    void* memory = nullptr;
+
+public:
+    LEPONG_NODISCARD constexpr bool IsValid() const noexcept
+    {
+        return memory;
+    }
+};
+
+///
+/// Creates an exchange for batches of the provided number of matches.
+///
+/// \param exchange The exchange to initialize, it is not movable.
+///
+/// \return Whether the exchange was created.
+///
+LEPONG_NODISCARD bool MakeSnapshotExchange(SnapshotExchange& exchange, unsigned numMatches) noexcept;
+
+///
+/// Destroys the provided exchange.<br>
+/// If the provided exchange is not valid, this function does nothing.
+///
+void DestroySnapshotExchange(SnapshotExchange& exchange) noexcept;
+
+///
+/// Copies the batch's state into the exchange. Must only be called by one thread.
+///
+void Publish(SnapshotExchange& exchange, const Batch& batch) noexcept;
+
+///
+/// \return The latest published snapshot. Must only be called by one thread.<br>
+/// The snapshot is not modified until the next call.
+///
+LEPONG_NODISCARD const Snapshot& Acquire(SnapshotExchange& exchange) noexcept;
+
+} // namespace lepong::Batch
@@ -0,0 +1,55 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "lepong/Attribute.h"
+
+namespace lepong::Batch
+{
+
+// The NUMA nodes of the host and the logical processors they own, so that batches can be sharded across them.
+
+static constexpr unsigned skMaxNodes = 64u;
+static constexpr unsigned skMaxCpus = 1024u;
+
+struct Node
+{
+    // The operating system's node number.
+    unsigned id = 0u;
+
+    unsigned numCpus = 0u;
+
+    // One bit per logical processor. On Windows, each processor group takes the next 64 bits.
+    std::uint64_t cpus[skMaxCpus / 64u] = {};
+};
+
+struct Topology
+{
+    unsigned numNodes = 0u;
+    Node nodes[skMaxNodes];
+
+public:
+    LEPONG_NODISCARD constexpr bool IsNuma() const noexcept
+    {
+        return numNodes > 1u;
+    }
+};
+
+///
+/// Lists the nodes that have logical processors.<br>
+/// If the topology can't be queried, the host is described as a single node with every processor.
+///
+LEPONG_NODISCARD Topology QueryTopology() noexcept;
+
+///
+/// Restricts the calling thread to the logical processors of the provided node.
+///
+/// \return Whether the thread was pinned.
+///
+LEPONG_NODISCARD bool PinCurrentThread(const Node& node) noexcept;
+
+} // namespace lepong::Batch
@@ -0,0 +1,55 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+
+#include "Attribute.h"
+
+namespace lepong::FileMapping
+{
+
+///
+/// A view of a file mapped in memory.
+///
+struct Mapping
+{
+    void* data = nullptr;
+    std::size_t size = 0;
+
+    // Operating system handles.
+    void* file = nullptr;
+    void* mapping = nullptr;
+
+public:
+    LEPONG_NODISCARD constexpr bool IsValid() const noexcept
+    {
+        return data;
+    }
+};
+
+///
+/// Maps the whole file at the provided path for reading.<br>
+/// Empty or missing files can't be mapped and result in an invalid mapping.
+///
+/// \return The new mapping, not destroying it results in a resource leak.
+///
+LEPONG_NODISCARD Mapping MakeReadOnlyMapping(const char* path) noexcept;
+
+///
+/// Maps the first <i>size</i> bytes of the file at the provided path for reading and writing.<br>
+/// The file is created if it doesn't exist and grown if it is smaller than <i>size</i>.
+///
+/// \return The new mapping, not destroying it results in a resource leak.
+///
+LEPONG_NODISCARD Mapping MakeReadWriteMapping(const char* path, std::size_t size) noexcept;
+
+///
+/// Unmaps the provided mapping.<br>
+/// If the mapping is not valid, this function does nothing.
+///
+void DestroyMapping(Mapping& mapping) noexcept;
+
+} // namespace lepong::FileMapping
@@ -0,0 +1,107 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "Match.h"
+
+namespace lepong::Analytics
+{
+
+static constexpr std::uint32_t skMaxHits = 4096u;
+static constexpr std::uint32_t skMaxPoints = 1024u;
+
+///
+/// The events recorded between two writes to the analytics file, one array per value.
+///
+struct Chunk
+{
+    // Paddle hits.
+    std::uint32_t numHits = 0u;
+    float hitTimes[skMaxHits];
+    float hitOffsets[skMaxHits]; // Where the ball hit the paddle, from -0.5 (bottom) to 0.5 (top).
+    float hitSpeeds[skMaxHits];  // The ball's speed before the hit.
+    std::uint8_t hitSides[skMaxHits];
+
+    // Points.
+    std::uint32_t numPoints = 0u;
+    float pointTimes[skMaxPoints];
+    float timesToPoint[skMaxPoints]; // Time between the launch and the point.
+    std::uint32_t rallyLengths[skMaxPoints]; // In paddle hits.
+    std::uint8_t lostSides[skMaxPoints];
+};
+
+///
+/// The events of a match.<br>
+/// Events are recorded into one chunk while the other waits to be written. When the recording chunk is full the two
+/// are swapped and the full one is only written by the next <code>WritePending</code>, so recording an event never
+/// allocates nor touches the file in the middle of an update.
+///
+struct MatchAnalytics
+{
+    std::uint32_t seed = 0u;
+
+    Chunk chunks[2];
+    unsigned recordingChunk = 0u;
+
+    // Whether the other chunk is full and waiting to be written.
+    bool writePending = false;
+
+    // Events recorded while both chunks were full, which are lost.
+    std::uint32_t numDroppedEvents = 0u;
+};
+
+///
+/// The start of every chunk in the analytics file.<br>
+/// The chunk's hit columns follow it, then its point columns, in the order they are declared in
+/// <code>MatchAnalytics</code>.
+///
+struct ChunkHeader
+{
+    std::uint32_t magic = 0u;
+    std::uint32_t seed = 0u;
+    std::uint32_t numHits = 0u;
+    std::uint32_t numPoints = 0u;
+};
+
+static constexpr std::uint32_t skChunkMagic = 0x4E414C4Cu; // "LLAN".
+
+///
+/// Opens the analytics file for appending.<br>
+/// If the analytics system is already initialized, this function returns false.
+///
+/// \return Whether the analytics system was successfully initialized.
+///
+LEPONG_NODISCARD bool Init() noexcept;
+
+///
+/// Closes the analytics file.
+///
+void Cleanup() noexcept;
+
+///
+/// Clears the provided buffers for a new match.
+///
+void BeginMatch(MatchAnalytics& analytics, std::uint32_t seed) noexcept;
+
+///
+/// \return A match listener that records events into the provided buffers.
+///
+LEPONG_NODISCARD MatchListener MakeListener(MatchAnalytics& analytics) noexcept;
+
+///
+/// Appends the chunk waiting to be written to the analytics file, if any.<br>
+/// Meant to be called once per frame, outside of the updates.
+///
+void WritePending(MatchAnalytics& analytics) noexcept;
+
+///
+/// Appends all the recorded events to the analytics file and clears the chunks.<br>
+/// If no event was recorded, this function does nothing.
+///
+void Flush(MatchAnalytics& analytics) noexcept;
+
+} // namespace lepong::Analytics
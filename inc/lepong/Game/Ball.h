@@ -70,4 +70,10 @@ private:
 ///
 LEPONG_NODISCARD GLuint MakeBallFragmentShader() noexcept;
 
+///
+/// Same as above but without the glow, for when the glow comes from the bloom effect.<br>
+/// Fragments outside the circle are discarded.
+///
+LEPONG_NODISCARD GLuint MakeBallCoreFragmentShader() noexcept;
+
 } // namespace lepong
@@ -6,4 +6,6 @@
 
 #include "Ball.h"
 #include "GameObject.h"
+#include "Match.h"
 #include "Paddle.h"
+#include "State.h"
@@ -0,0 +1,92 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "lepong/Batch/Batch.h"
+#include "lepong/Batch/Snapshot.h"
+#include "lepong/Graphics/Mesh.h"
+#include "lepong/Math/Vector2.h"
+
+namespace lepong::GridViewer
+{
+
+// Watches a batch of matches played by a simple policy, tiled in a K by K grid.<br>
+// The batch is stepped as fast as possible on its own thread, the viewer draws whatever snapshot was published last.
+// Every paddle and ball instance is written to one instance buffer straight from the snapshot's arrays, then each
+// program draws all of its instances at once: two draws per frame whatever the grid size.
+
+///
+/// Set this environment variable to the grid size (K) to show K×K matches instead of the local match.
+///
+static constexpr const char* skSelectionVariable = "LEPONG_GRID";
+
+static constexpr unsigned skMaxGridSize = 64u;
+
+// The policy decides every skActionRepeat ticks, a snapshot is published once per decision.
+static constexpr unsigned skActionRepeat = 4u;
+
+struct Viewer
+{
+    unsigned gridSize = 0u;
+    Vector2i winSize;
+
+    // Simulation, only touched by the simulation thread once started.
+    Batch::Batch batch;
+
+    Batch::SnapshotExchange exchange;
+
+    std::thread simulationThread;
+    std::atomic<bool> stopping = false;
+    std::uint64_t startTime = 0u;
+
+    // Rendering.
+    GLuint paddleProgram = 0;
+    GLuint ballProgram = 0;
+
+    Graphics::Mesh quad;
+    Graphics::Mesh texturedQuad;
+
+    // Paddle instances first, then ball instances.
+    GLuint instanceBuffer = 0;
+
+public:
+    LEPONG_NODISCARD bool IsValid() const noexcept
+    {
+        return simulationThread.joinable();
+    }
+};
+
+///
+/// \return The grid size selected with the environment variable, 0 if the viewer was not selected.
+///
+LEPONG_NODISCARD unsigned GetSelectedGridSize() noexcept;
+
+///
+/// Creates the viewer's resources and starts simulating.
+///
+/// \param viewer The viewer to initialize, it is not movable.
+/// \param gridSize The number of matches on each side of the grid, at most skMaxGridSize.
+/// \param winSize The size of the window the grid covers, in world units.
+///
+/// \return Whether the viewer was created.
+///
+LEPONG_NODISCARD bool MakeViewer(Viewer& viewer, unsigned gridSize, const Vector2i& winSize) noexcept;
+
+///
+/// Stops simulating and destroys the viewer's resources.<br>
+/// Any resource that was not created is skipped.
+///
+void DestroyViewer(Viewer& viewer) noexcept;
+
+///
+/// Draws the latest published state of every match.
+///
+void Render(Viewer& viewer) noexcept;
+
+} // namespace lepong::GridViewer
@@ -0,0 +1,133 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "Ball.h"
+#include "Paddle.h"
+#include "State.h"
+
+namespace lepong
+{
+
+class Match;
+
+///
+/// Called when the ball bounces off a paddle.<br>
+/// The match is in its post-bounce state, <i>hitSpeed</i> is the ball's speed right before the bounce.
+///
+using PFNPaddleHitCallback = void (*)(void* user, const Match& match, Side side, float hitSpeed);
+
+///
+/// Called when the ball touches a side, right before the point is given and the match is reset.
+///
+using PFNPointCallback = void (*)(void* user, const Match& match, Side lostSide);
+
+///
+/// Called when a point gives a player the winning score, after the point is given.<br>
+/// The match stays over, with its final scores, until it is started again.
+///
+using PFNMatchEndCallback = void (*)(void* user, const Match& match, Side winner);
+
+///
+/// The functions notified of match events. Any of them can be nullptr.
+///
+struct MatchListener
+{
+    void* user = nullptr;
+
+    PFNPaddleHitCallback onPaddleHit = nullptr;
+    PFNPointCallback onPoint = nullptr;
+    PFNMatchEndCallback onMatchEnd = nullptr;
+};
+
+///
+/// The game rules, independent of any window or input device.<br>
+/// A match only needs rendering resources to render, it can be simulated without a context.
+///
+class Match
+{
+public:
+    // Hardcoded but this should be fine on most monitors (maybe a bit small for 2k+).
+    static constexpr Vector2i skTerrainSize = { 1280, 720 };
+
+    static constexpr Vector2f skPaddleSize = { 25.0f, 150.0f };
+    static constexpr float skBallRadius = 20.0f;
+
+    // The first player to reach this score wins the match.
+    static constexpr unsigned skWinningScore = 11u;
+
+public:
+    Ball ball;
+    Paddle paddle1;
+    Paddle paddle2;
+
+    bool playing = false;
+    unsigned playerScores[2] = { 0u, 0u };
+
+    // Statistics.
+    std::uint64_t tick = 0u;
+    float time = 0.0f;
+    unsigned numRallies = 0u;
+    unsigned numPaddleHits = 0u;
+
+    // The rally being played, or the last one if the ball is not launched.
+    float rallyStartTime = 0.0f;
+    unsigned numRallyHits = 0u;
+
+    MatchListener listener;
+
+public:
+    Match(Graphics::Mesh& quad, Graphics::Mesh& texturedQuad, GLuint& paddleProgram, GLuint& ballProgram) noexcept;
+
+public:
+    ///
+    /// Puts the ball and paddles in their starting positions and clears the scores and statistics.<br>
+    /// The random number generator should be seeded before calling this.
+    ///
+    void Start() noexcept;
+
+    ///
+    /// \param key The key's virtual key code.
+    /// \param pressed Whether the key was pressed.
+    ///
+    void OnKeyEvent(int key, bool pressed) noexcept;
+
+    ///
+    /// Advances the match by the provided time in seconds.
+    ///
+    void Update(float delta) noexcept;
+
+public:
+    ///
+    /// \return A copy of the match state.
+    ///
+    LEPONG_NODISCARD State CaptureState() const noexcept;
+
+    ///
+    /// Puts the match back in a captured state. This also reseeds the calling thread's random number generator.<br>
+    /// Statistics are left untouched.
+    ///
+    void RestoreState(const State& state) noexcept;
+
+private:
+    void OnKeyDown(int key) noexcept;
+    void OnKeyUp(int key) noexcept;
+    void LaunchBall() noexcept;
+
+private:
+    bool CollideBallWith(const Paddle& paddle, Side side) noexcept;
+    void CheckBallSideCollision() noexcept;
+    void Reset() noexcept;
+};
+
+///
+/// \return A match that is never rendered, to re-simulate recorded matches. Its objects reference shared empty
+/// resources.
+///
+LEPONG_NODISCARD Match MakeHeadlessMatch() noexcept;
+
+} // namespace lepong
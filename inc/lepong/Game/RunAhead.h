@@ -0,0 +1,116 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "Match.h"
+
+namespace lepong::RunAhead
+{
+
+// Hides the tick between a key press and the frame that shows it: after the real tick, the match is simulated a few
+// ticks ahead with the keys currently held, that predicted state is rendered, then the match is rolled back to the
+// real state before the next events are processed. Only the rendered frame sees the prediction, the replays, hashes
+// and analytics only see the real ticks.<br>
+// The extra ticks are budgeted against the measured cost of a tick: no more ticks are simulated ahead than fit in a
+// share of the frame time, none at all on hosts where a single one doesn't fit.
+
+///
+/// Set this environment variable to the number of ticks to simulate ahead, at most skMaxTicks.
+///
+static constexpr const char* skSelectionVariable = "LEPONG_RUN_AHEAD";
+
+static constexpr unsigned skMaxTicks = 4u;
+
+// The extra ticks never take more than this part of the frame time.
+static constexpr float skBudget = 0.1f;
+
+///
+/// The real match, saved before simulating ahead.<br>
+/// The statistics and listener are not part of the state but must not see the predicted ticks either.
+///
+struct Checkpoint
+{
+    State state;
+
+    std::uint64_t tick = 0u;
+    float time = 0.0f;
+    unsigned numRallies = 0u;
+    unsigned numPaddleHits = 0u;
+    float rallyStartTime = 0.0f;
+    unsigned numRallyHits = 0u;
+
+    MatchListener listener;
+};
+
+struct Predictor
+{
+    // The selected number of ticks, and the number that currently fits in the budget.
+    unsigned maxTicks = 0u;
+    unsigned numTicks = 0u;
+
+    // Smoothed, in nanoseconds.
+    std::uint64_t tickCost = 0u;
+    std::uint64_t frameTime = 0u;
+
+    Checkpoint checkpoint;
+    bool predicting = false;
+
+    std::uint64_t numFrames = 0u;
+    std::uint64_t numPredictedFrames = 0u;
+
+public:
+    LEPONG_NODISCARD constexpr bool IsValid() const noexcept
+    {
+        return maxTicks > 0u;
+    }
+};
+
+///
+/// \return The number of ticks selected with the environment variable, 0 if run-ahead is not enabled.
+///
+LEPONG_NODISCARD unsigned GetSelectedTicks() noexcept;
+
+///
+/// Makes a predictor that simulates up to the provided number of ticks ahead.<br>
+/// Nothing is simulated ahead until a tick and a frame were measured.
+///
+LEPONG_NODISCARD Predictor MakePredictor(unsigned maxTicks) noexcept;
+
+///
+/// Logs how many frames were predicted.
+///
+void LogSummary(const Predictor& predictor) noexcept;
+
+///
+/// Records the cost of a real tick.
+///
+/// \param nanoseconds How long the tick took.
+///
+void RecordTick(Predictor& predictor, std::uint64_t nanoseconds) noexcept;
+
+///
+/// Adjusts the number of ticks simulated ahead to a measured frame time.
+///
+/// \param frameTime In nanoseconds.
+///
+void Adjust(Predictor& predictor, std::uint64_t frameTime) noexcept;
+
+///
+/// Saves the match and simulates it ahead, must be followed by <i>EndPrediction</i> once the frame is rendered.<br>
+/// If the predictor is not valid or nothing fits in the budget, this function does nothing.
+///
+/// \param delta The time step of each predicted tick in seconds.
+///
+void BeginPrediction(Predictor& predictor, Match& match, float delta) noexcept;
+
+///
+/// Rolls the match back to the state saved by <i>BeginPrediction</i>.<br>
+/// If nothing was predicted, this function does nothing.
+///
+void EndPrediction(Predictor& predictor, Match& match) noexcept;
+
+} // namespace lepong::RunAhead
@@ -0,0 +1,64 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include "lepong/Graphics/Graphics.h"
+
+#include "Match.h"
+
+namespace lepong::SdfRenderer
+{
+
+// An alternative to drawing every object with its own quad: the paddles and the ball are evaluated analytically
+// in a single full-screen pass, with the same pixel center coverage rules as the quads. That's one program bind and
+// one draw per frame, at the cost of shading every pixel. Rounding can still differ at the edges, compare the two
+// with lepong_glreplay --dump before relying on it.
+
+///
+/// Set this environment variable to <code>sdf</code> to render with this renderer.
+///
+static constexpr const char* skSelectionVariable = "LEPONG_RENDERER";
+
+struct Renderer
+{
+    GLuint program = 0;
+
+    // Core contexts can't draw without a vertex array, even an empty one.
+    GLuint vertexArray = 0;
+
+    GLint objectsLocation = -1;
+
+public:
+    LEPONG_NODISCARD constexpr bool IsValid() const noexcept
+    {
+        return program && vertexArray;
+    }
+};
+
+///
+/// \return Whether the renderer was selected with the environment variable.
+///
+LEPONG_NODISCARD bool IsSelected() noexcept;
+
+///
+/// Creates the renderer's program.<br>
+/// If the program fails to compile or link, the returned renderer is not valid.
+///
+LEPONG_NODISCARD Renderer MakeRenderer() noexcept;
+
+///
+/// Destroys the renderer's resources.<br>
+/// If the provided renderer is not valid, this function does nothing.
+///
+void DestroyRenderer(Renderer& renderer) noexcept;
+
+///
+/// Draws the whole match. Window pixels are mapped to the terrain through the frame uniforms, so any window size
+/// works.<br>
+/// Every pixel is written, the frame doesn't need to be cleared.
+///
+void Render(const Renderer& renderer, const Match& match) noexcept;
+
+} // namespace lepong::SdfRenderer
@@ -0,0 +1,59 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "lepong/Attribute.h"
+#include "lepong/Math/Vector2.h"
+
+namespace lepong
+{
+
+///
+/// A plain copy of everything that decides how the game plays out: ball, paddles, scores and random state.<br>
+/// The layout has no padding so it can be hashed and compared as raw memory.
+///
+struct State
+{
+    Vector2f ballPosition;
+    Vector2f ballMoveDirection;
+    float ballMoveSpeed = 0.0f;
+
+    Vector2f paddle1Position;
+    float paddle1MoveDirectionY = 0.0f;
+    float paddle1MoveSpeed = 0.0f;
+
+    Vector2f paddle2Position;
+    float paddle2MoveDirectionY = 0.0f;
+    float paddle2MoveSpeed = 0.0f;
+
+    std::uint32_t playerScores[2] = { 0u, 0u };
+    std::uint32_t playing = 0u;
+    std::uint32_t randomState = 0u;
+
+    // Keeps the size a multiple of 8 bytes so the hash can work on whole words.
+    std::uint32_t reserved = 0u;
+};
+
+static_assert(std::is_trivially_copyable_v<State>);
+static_assert(sizeof(State) % sizeof(std::uint64_t) == 0);
+
+///
+/// Hashes the provided state.<br>
+/// Equal states always have the same hash, this is cheap enough to be done every tick.
+///
+LEPONG_NODISCARD std::uint64_t HashState(const State& state) noexcept;
+
+///
+/// Compares the provided states field by field.<br>
+/// Every differing field is logged along with the tick it was detected at.
+///
+/// \return Whether the states are identical.
+///
+LEPONG_NODISCARD bool CheckStatesMatch(std::uint64_t tick, const State& expected, const State& actual) noexcept;
+
+} // namespace lepong
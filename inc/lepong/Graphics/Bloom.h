@@ -0,0 +1,123 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include "lepong/Math/Vector2.h"
+
+#include "Graphics.h"
+#include "Mesh.h"
+
+namespace lepong::Bloom
+{
+
+// Makes bright objects glow.<br>
+// Emitters are drawn a second time into a half resolution target, the bright pass. Their bright parts are downsampled
+// down the chain of levels, the last level is blurred with a separable Gaussian, then the chain is upsampled back with
+// a tent filter, each level adding its own glow, and the composite magnifies the first upsampled level. Every pass
+// only covers the regions around the emitters, the only full resolution one being the composite. The targets are
+// created once and reused every frame.<br>
+// Nothing is blended: software rasterizers pay a lot for it. Instead the composite writes the glow before the emitters
+// are drawn over it, which gives the same result over the game's black background.
+
+///
+/// Set this environment variable to <code>1</code> to enable the effect.
+///
+static constexpr const char* skSelectionVariable = "LEPONG_BLOOM";
+
+// Half, quarter and eighth resolution.
+static constexpr unsigned skNumLevels = 3u;
+
+// How far the glow reaches from an emitter, in world units. This bounds the passes.<br>
+// In pixels in each direction: 4 and 8 for the downsamples, 16 for the blur, 12 for the upsample and 6 for the
+// composite, with margin.
+static constexpr float skRadius = 48.0f;
+
+static constexpr unsigned skMaxRegions = 8u;
+
+struct Effect
+{
+    // The levels are sized after the window the effect was made for, they keep covering it when it is resized.
+    Vector2i winSize;
+
+    // Where the glow is written, the window's framebuffer unless the scene is rendered offscreen.
+    GLuint targetFramebuffer = 0;
+    Vector2i targetSize;
+
+    // The downsampled levels.
+    GLuint textures[skNumLevels] = {};
+    GLuint framebuffers[skNumLevels] = {};
+    Vector2i levelSizes[skNumLevels];
+
+    // The last level is blurred horizontally into this target, then vertically back.
+    GLuint blurTexture = 0;
+    GLuint blurFramebuffer = 0;
+
+    // The upsampled levels, from the second level to the one before the last.
+    GLuint upsampledTextures[skNumLevels - 2u] = {};
+    GLuint upsampledFramebuffers[skNumLevels - 2u] = {};
+
+    GLuint downsampleProgram = 0;
+    GLuint blurProgram = 0;
+    GLuint upsampleProgram = 0;
+    GLuint compositeProgram = 0;
+
+    GLint downsampleTexelSizeLocation = -1;
+    GLint downsampleThresholdLocation = -1;
+    GLint blurStepLocation = -1;
+    GLint upsampleTexelSizeLocation = -1;
+
+    // Every pass draws one quad per region.
+    Graphics::Mesh quad;
+    GLuint regionBuffer = 0;
+
+public:
+    LEPONG_NODISCARD constexpr bool IsValid() const noexcept
+    {
+        return compositeProgram && regionBuffer;
+    }
+};
+
+///
+/// \return Whether the effect was enabled with the environment variable.
+///
+LEPONG_NODISCARD bool IsSelected() noexcept;
+
+///
+/// Creates the effect's programs and render targets for a window of the provided size.<br>
+/// If any resource can't be created, the returned effect is not valid.
+///
+LEPONG_NODISCARD Effect MakeEffect(const Vector2i& winSize) noexcept;
+
+///
+/// Destroys the effect's resources.<br>
+/// Any resource that was not created is skipped.
+///
+void DestroyEffect(Effect& effect) noexcept;
+
+///
+/// Sets the framebuffer the glow is written to, and the size of the viewport that covers the window in it.
+///
+void SetTarget(Effect& effect, GLuint framebuffer, const Vector2i& size) noexcept;
+
+///
+/// Binds and clears the half resolution target. Anything drawn until <i>EndEmitters</i> glows.
+///
+void BeginEmitters(const Effect& effect) noexcept;
+
+///
+/// Binds the target again.
+///
+void EndEmitters(const Effect& effect) noexcept;
+
+///
+/// Blurs the emitters and writes the glow to the target, the emitters must be drawn afterwards.
+///
+/// \param regions The emitters' bounds, a center and a size in world units per region. The glow is only written around
+/// them.
+/// \param numRegions At most skMaxRegions.
+///
+void Apply(const Effect& effect, const GLfloat* regions, unsigned numRegions) noexcept;
+
+} // namespace lepong::Bloom
@@ -0,0 +1,140 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "lepong/Math/Vector2.h"
+
+#include "Graphics.h"
+
+namespace lepong::Graphics::DynamicResolution
+{
+
+// Renders the scene at a resolution that follows the GPU frame time, then stretches it over the window. The resolution
+// drops when frames take longer than the budget and rises back once they leave enough room, so a slow or shared host
+// keeps its frame rate instead of dropping frames.<br>
+// At full resolution the scene is rendered to the window directly and the scaling costs nothing. Lower resolutions
+// render to the bottom left corner of an offscreen target the size of the window, which is then drawn over the window
+// with a single triangle.<br>
+// Stretching is a full window pass. On software rasterizers it can cost more than the scene itself, so a lower
+// resolution that doesn't make frames faster is reverted, and the scaler waits before trying again.<br>
+// Frame times come from the GPU timer and are a few frames old: after every change, the scaler waits for frames
+// rendered at the new resolution before judging it.
+
+///
+/// Set this environment variable to a frame time budget in milliseconds to enable the scaling.
+///
+static constexpr const char* skSelectionVariable = "LEPONG_DYNAMIC_RESOLUTION";
+
+// The scale of each dimension never goes below this.
+static constexpr float skMinScale = 0.5f;
+
+// The scale only rises when frames take less than this part of the budget.
+static constexpr float skHeadroom = 0.8f;
+
+// Part of the frame time doesn't depend on the resolution, the scale rises by at most this much at once.
+static constexpr float skMaxScaleIncrease = 0.1f;
+
+// Render sizes are rounded to multiples of this, so the scale doesn't change for a few pixels.
+static constexpr int skSizeGranularity = 8;
+
+// How many frames are measured at a resolution before it is judged.
+static constexpr unsigned skNumSamples = 8u;
+
+// How many frames the scaler waits after reverting a lower resolution before lowering it again.
+static constexpr unsigned skRetryPeriod = 600u;
+
+struct Scaler
+{
+    Vector2i winSize;
+
+    GLuint texture = 0;
+    GLuint framebuffer = 0;
+
+    // Draws the target over the window.
+    GLuint program = 0;
+    GLuint vertexArray = 0;
+    GLint scaleLocation = -1;
+    GLint maxTextureCoordsLocation = -1;
+
+    std::uint64_t budget = 0u;
+
+    // Smoothed over the frames measured at the current resolution, in nanoseconds.
+    std::uint64_t frameTime = 0u;
+    unsigned numSamples = 0u;
+
+    float scale = 1.0f;
+    Vector2i renderSize;
+
+    // What the last change replaced, to revert it if it didn't help.
+    float previousScale = 1.0f;
+    std::uint64_t previousFrameTime = 0u;
+
+    unsigned framesUntilAdjust = 0u;
+    unsigned framesUntilRetry = 0u;
+
+public:
+    LEPONG_NODISCARD constexpr bool IsValid() const noexcept
+    {
+        return framebuffer && program;
+    }
+
+    LEPONG_NODISCARD constexpr bool IsScaled() const noexcept
+    {
+        return renderSize.x != winSize.x || renderSize.y != winSize.y;
+    }
+
+    ///
+    /// \return The framebuffer the scene is rendered to, the window's one at full resolution.
+    ///
+    LEPONG_NODISCARD constexpr GLuint GetTargetFramebuffer() const noexcept
+    {
+        return IsScaled() ? framebuffer : 0;
+    }
+};
+
+///
+/// \return The frame time budget set with the environment variable in nanoseconds, 0 if the scaling is not enabled.
+///
+LEPONG_NODISCARD std::uint64_t GetSelectedBudget() noexcept;
+
+///
+/// Creates the offscreen target for a window of the provided size, the scene starts at full resolution.<br>
+/// If any resource can't be created, the returned scaler is not valid.
+///
+/// \param budget The GPU frame time to hold, in nanoseconds.
+///
+LEPONG_NODISCARD Scaler MakeScaler(const Vector2i& winSize, std::uint64_t budget) noexcept;
+
+///
+/// Destroys the scaler's resources.<br>
+/// Any resource that was not created is skipped.
+///
+void DestroyScaler(Scaler& scaler) noexcept;
+
+///
+/// Resizes the offscreen target to a new window size. The scale is kept, its frame times are measured again.
+///
+void Resize(Scaler& scaler, const Vector2i& winSize) noexcept;
+
+///
+/// Adjusts the resolution to a measured GPU frame time.
+///
+/// \param frameTime In nanoseconds, 0 if no frame was measured yet.
+///
+void Update(Scaler& scaler, std::uint64_t frameTime) noexcept;
+
+///
+/// Binds the scene's framebuffer and sets the viewport to the current resolution.
+///
+void BeginScene(const Scaler& scaler) noexcept;
+
+///
+/// Stretches the scene over the window if its resolution is lower, and binds the window's framebuffer again.
+///
+void EndScene(const Scaler& scaler) noexcept;
+
+} // namespace lepong::Graphics::DynamicResolution
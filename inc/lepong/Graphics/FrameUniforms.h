@@ -0,0 +1,73 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include "lepong/Attribute.h"
+#include "lepong/Math/Vector2.h"
+
+#include "Graphics.h"
+
+namespace lepong::Graphics::FrameUniforms
+{
+
+// The values every program shares, uploaded once per frame to a single uniform buffer instead of once per program.<br>
+// Programs declare the block with <i>LEPONG_GLSL_FRAME_BLOCK</i>, <i>CreateProgramFromShaders</i> binds it.<br>
+// Positions are in world units, the terrain's pixels at the initial window size. The projection fits the world in
+// the window without stretching it, so the window can have any size or pixel density.
+
+///
+/// The block's declaration, to be concatenated after the <code>#version</code> line of a shader:<br>
+/// - <b>uProjection</b>: Transforms world positions to clip space.<br>
+/// - <b>uWinSize</b>: The size of the window in pixels.<br>
+/// - <b>uTime</b>: The time passed to the last update in seconds.
+///
+#define LEPONG_GLSL_FRAME_BLOCK \
+    "layout (std140) uniform Frame { mat4 uProjection; vec2 uWinSize; float uTime; };\n"
+
+static constexpr const char* skBlockName = "Frame";
+static constexpr GLuint skBinding = 0u;
+
+///
+/// The block's std140 layout.
+///
+struct Block
+{
+    GLfloat projection[16] = {};
+    GLfloat winSize[2] = {};
+    GLfloat time = 0.0f;
+
+    // The block's size is a multiple of a vec4.
+    GLfloat padding = 0.0f;
+};
+
+static_assert(sizeof(Block) == 80u);
+
+///
+/// Creates the uniform buffer and binds it, the current context is used.<br>
+/// If the system is already initialized, this function returns false.
+///
+/// \param worldSize The area the projection always shows.
+/// \param winSize The initial size of the window in pixels.
+///
+/// \return Whether the system was successfully initialized.
+///
+LEPONG_NODISCARD bool Init(const Vector2i& worldSize, const Vector2i& winSize) noexcept;
+
+///
+/// Destroys the uniform buffer.
+///
+void Cleanup() noexcept;
+
+///
+/// Recomputes the projection for a new window size, the block is uploaded with the next update.
+///
+void Resize(const Vector2i& winSize) noexcept;
+
+///
+/// Uploads the block, must be called once per frame before anything is rendered.
+///
+void Update(float time) noexcept;
+
+} // namespace lepong::Graphics::FrameUniforms
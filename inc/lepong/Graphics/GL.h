@@ -22,6 +22,9 @@ struct Context
     HDC device = nullptr;
     HGLRC context = nullptr;
 
+    // The context's OpenGL functions, used by the interface while the context is current.
+    Dispatch dispatch;
+
 public:
     LEPONG_NODISCARD constexpr bool IsValid() const noexcept
     {
@@ -30,7 +33,7 @@ public:
 };
 
 ///
-/// Loads all the functions required by the OpenGL interface.<br>
+/// Loads the functions required to create contexts.<br>
 /// If the OpenGL interface is already initialized, this function returns false.
 ///
 /// \return Whether the OpenGL interface was successfully initialized.
@@ -44,7 +47,8 @@ LEPONG_NODISCARD bool Init() noexcept;
 void Cleanup() noexcept;
 
 ///
-/// Creates an OpenGL context for the provided window with the latest version available.<br>
+/// Creates an OpenGL context for the provided window with the latest version available, and loads its functions.<br>
+/// Every missing function is logged, in which case the returned context is not valid.<br>
 /// Not storing the returned context results in a memory leak.
 ///
 /// \return The newly created context.
@@ -52,7 +56,8 @@ void Cleanup() noexcept;
 LEPONG_NODISCARD Context MakeContext(HWND window) noexcept;
 
 ///
-/// Sets the provided context as the current OpenGL context.
+/// Sets the provided context as the current OpenGL context of the calling thread.<br>
+/// The OpenGL interface calls the context's functions until another context is made current.
 ///
 void MakeContextCurrent(const Context& context) noexcept;
 
@@ -0,0 +1,115 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(_WIN32)
+#include <Windows.h> // Needed by "GL.h".
+#include <GL/GL.h>
+#else
+// The types below are declared here, not by "glext.h".
+#define GL_GLEXT_LEGACY
+#include <GL/gl.h>
+
+// Only the Windows functions have a calling convention.
+#define WINAPI
+#endif
+
+using GLchar = char;
+using GLsizeiptr = std::uintptr_t;
+using GLuint64 = std::uint64_t;
+
+namespace lepong::Graphics::GL
+{
+
+// Every OpenGL function used by the interface, as X(return type, name without the gl prefix, parameter types).<br>
+// The function pointer types, the dispatch table and the loader are all generated from this list, a function is
+// added to the interface by adding it here and writing its wrapper in "GLInterface.h".
+#define LEPONG_GL_FUNCTIONS(X) \
+    X(GLuint, CreateShader, (GLenum))                                                                 \
+    X(void, DeleteShader, (GLuint))                                                                   \
+    X(void, ShaderSource, (GLuint, GLsizei, const GLchar**, const GLint*))                            \
+    X(void, CompileShader, (GLuint))                                                                  \
+    X(void, GetShaderiv, (GLuint, GLenum, GLint*))                                                    \
+    X(void, GetShaderInfoLog, (GLuint, GLsizei, GLsizei*, GLchar*))                                   \
+    X(GLuint, CreateProgram, ())                                                                      \
+    X(void, DeleteProgram, (GLuint))                                                                  \
+    X(void, AttachShader, (GLuint, GLuint))                                                           \
+    X(void, LinkProgram, (GLuint))                                                                    \
+    X(void, GetProgramiv, (GLuint, GLenum, GLint*))                                                   \
+    X(void, GetProgramInfoLog, (GLuint, GLsizei, GLsizei*, GLchar*))                                  \
+    X(void, UseProgram, (GLuint))                                                                     \
+    X(void, GenVertexArrays, (GLsizei, GLuint*))                                                      \
+    X(void, DeleteVertexArrays, (GLsizei, const GLuint*))                                             \
+    X(void, BindVertexArray, (GLuint))                                                                \
+    X(void, GenBuffers, (GLsizei, GLuint*))                                                           \
+    X(void, DeleteBuffers, (GLsizei, const GLuint*))                                                  \
+    X(void, BindBuffer, (GLenum, GLuint))                                                             \
+    X(void, BufferData, (GLenum, GLsizeiptr, const void*, GLenum))                                    \
+    X(void, BufferSubData, (GLenum, GLsizeiptr, GLsizeiptr, const void*))                             \
+    X(void, EnableVertexAttribArray, (GLuint))                                                        \
+    X(void, VertexAttribPointer, (GLuint, GLint, GLenum, GLboolean, GLsizei, const void*))            \
+    X(void, VertexAttribDivisor, (GLuint, GLuint))                                                    \
+    X(void, DrawElements, (GLenum, GLsizei, GLenum, const void*))                                     \
+    X(void, DrawElementsInstanced, (GLenum, GLsizei, GLenum, const void*, GLsizei))                   \
+    X(void, DrawArrays, (GLenum, GLint, GLsizei))                                                     \
+    X(void, GenTextures, (GLsizei, GLuint*))                                                          \
+    X(void, DeleteTextures, (GLsizei, const GLuint*))                                                 \
+    X(void, BindTexture, (GLenum, GLuint))                                                            \
+    X(void, ActiveTexture, (GLenum))                                                                  \
+    X(void, TexImage2D, (GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const void*)) \
+    X(void, TexParameteri, (GLenum, GLenum, GLint))                                                   \
+    X(void, GenFramebuffers, (GLsizei, GLuint*))                                                      \
+    X(void, DeleteFramebuffers, (GLsizei, const GLuint*))                                             \
+    X(void, BindFramebuffer, (GLenum, GLuint))                                                        \
+    X(void, FramebufferTexture2D, (GLenum, GLenum, GLenum, GLuint, GLint))                            \
+    X(GLenum, CheckFramebufferStatus, (GLenum))                                                       \
+    X(void, Viewport, (GLint, GLint, GLsizei, GLsizei))                                               \
+    X(const GLubyte*, GetString, (GLenum))                                                            \
+    X(void, Clear, (GLbitfield))                                                                      \
+    X(void, Finish, ())                                                                               \
+    X(void, ReadPixels, (GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, void*))                      \
+    X(void, GenQueries, (GLsizei, GLuint*))                                                           \
+    X(void, DeleteQueries, (GLsizei, const GLuint*))                                                  \
+    X(void, QueryCounter, (GLuint, GLenum))                                                           \
+    X(void, GetQueryObjectiv, (GLuint, GLenum, GLint*))                                               \
+    X(void, GetQueryObjectui64v, (GLuint, GLenum, GLuint64*))                                         \
+    X(GLint, GetUniformLocation, (GLuint, const GLchar*))                                             \
+    X(void, Uniform2f, (GLint, GLfloat, GLfloat))                                                     \
+    X(void, Uniform1i, (GLint, GLint))                                                                \
+    X(void, Uniform1f, (GLint, GLfloat))                                                              \
+    X(void, Uniform4fv, (GLint, GLsizei, const GLfloat*))                                             \
+    X(GLuint, GetUniformBlockIndex, (GLuint, const GLchar*))                                          \
+    X(void, UniformBlockBinding, (GLuint, GLuint, GLuint))                                            \
+    X(void, BindBufferBase, (GLenum, GLuint, GLuint))                                                
+
+#define LEPONG_GL_DECLARE_FUNCTION_TYPE(returnType, name, parameters) \
+    using PFNgl##name = returnType (WINAPI*) parameters;
+
+LEPONG_GL_FUNCTIONS(LEPONG_GL_DECLARE_FUNCTION_TYPE)
+
+#undef LEPONG_GL_DECLARE_FUNCTION_TYPE
+
+///
+/// The OpenGL functions of a context. Function pointers may differ between contexts, each context loads its own.
+///
+struct Dispatch
+{
+#define LEPONG_GL_DECLARE_FUNCTION_POINTER(returnType, name, parameters) \
+    PFNgl##name gl##name = nullptr;
+
+    LEPONG_GL_FUNCTIONS(LEPONG_GL_DECLARE_FUNCTION_POINTER)
+
+#undef LEPONG_GL_DECLARE_FUNCTION_POINTER
+};
+
+///
+/// The dispatch table of the context current on this thread, which every wrapper calls through.<br>
+/// It is a copy rather than a pointer to the context's table so a call is a single indirection.
+///
+inline thread_local Dispatch tDispatch;
+
+} // namespace lepong::Graphics::GL
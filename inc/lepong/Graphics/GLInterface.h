@@ -5,171 +5,590 @@
 #pragma once
 
 #include <cstdint>
-#include <Windows.h> // Needed by "GL.h".
-#include <GL/GL.h>
+#include <cstring>
 
 #include "lepong/Attribute.h"
 
-using GLchar = char;
-using GLsizeiptr = std::uintptr_t;
+#include "GLFunctions.h"
+#include "Trace.h"
 
 namespace lepong::Graphics::GL
 {
 
 enum : GLenum
 {
-    False              = 0,
-    Triangles          = 0x0004,
-    UnsignedInt        = 0x1405,
-    Float              = 0x1406,
-    Vendor             = 0x1F00,
-    Renderer           = 0x1F01,
-    Version            = 0x1F02,
-    ColorBufferBit     = 0x4000,
-    ArrayBuffer        = 0x8892,
-    ElementArrayBuffer = 0x8893,
-    StaticDraw         = 0x88E4,
-    FragmentShader     = 0x8B30,
-    VertexShader       = 0x8B31,
-    CompileStatus      = 0x8B81,
-    LinkStatus         = 0x8B82,
-    InfoLogLength      = 0x8B84
+    False                = 0,
+    Triangles            = 0x0004,
+    Texture2D            = 0x0DE1,
+    UnsignedByte         = 0x1401,
+    UnsignedInt          = 0x1405,
+    Float                = 0x1406,
+    RGBA                 = 0x1908,
+    Vendor               = 0x1F00,
+    Renderer             = 0x1F01,
+    Version              = 0x1F02,
+    Linear               = 0x2601,
+    TextureMagFilter     = 0x2800,
+    TextureMinFilter     = 0x2801,
+    TextureWrapS         = 0x2802,
+    TextureWrapT         = 0x2803,
+    ColorBufferBit       = 0x4000,
+    RGBA8                = 0x8058,
+    ClampToEdge          = 0x812F,
+    Texture0             = 0x84C0,
+    QueryResult          = 0x8866,
+    QueryResultAvailable = 0x8867,
+    ArrayBuffer          = 0x8892,
+    ElementArrayBuffer   = 0x8893,
+    StreamDraw           = 0x88E0,
+    StaticDraw           = 0x88E4,
+    UniformBuffer        = 0x8A11,
+    FragmentShader       = 0x8B30,
+    VertexShader         = 0x8B31,
+    CompileStatus        = 0x8B81,
+    LinkStatus           = 0x8B82,
+    InfoLogLength        = 0x8B84,
+    FramebufferComplete  = 0x8CD5,
+    ColorAttachment0     = 0x8CE0,
+    Framebuffer          = 0x8D40,
+    Timestamp            = 0x8E28
 };
 
+// Returned by GetUniformBlockIndex when the program has no block of that name.
+static constexpr GLuint InvalidIndex = 0xFFFFFFFFu;
+
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glCreateShader.xhtml
 ///
-LEPONG_NODISCARD GLuint CreateShader(GLenum shaderType) noexcept;
+LEPONG_NODISCARD inline GLuint CreateShader(GLenum shaderType) noexcept
+{
+    const auto kShader = tDispatch.glCreateShader(shaderType);
+    Trace::Record(Trace::Call::CreateShader, shaderType, kShader);
+
+    return kShader;
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glDeleteShader.xhtml
 ///
-void DeleteShader(GLuint shader) noexcept;
+inline void DeleteShader(GLuint shader) noexcept
+{
+    Trace::Record(Trace::Call::DeleteShader, shader);
+    tDispatch.glDeleteShader(shader);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glShaderSource.xhtml
 ///
-void ShaderSource(GLuint shader, GLsizei count, const GLchar** string, const GLint* length) noexcept;
+inline void ShaderSource(GLuint shader, GLsizei count, const GLchar** string, const GLint* length) noexcept
+{
+    Trace::Record(Trace::Call::ShaderSource, shader, Trace::Sources{ count, string, length });
+    tDispatch.glShaderSource(shader, count, string, length);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glCompileShader.xhtml
 ///
-void CompileShader(GLuint shader) noexcept;
+inline void CompileShader(GLuint shader) noexcept
+{
+    Trace::Record(Trace::Call::CompileShader, shader);
+    tDispatch.glCompileShader(shader);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glGetShader.xhtml
 ///
-void GetShaderiv(GLuint shader, GLenum pname, GLint* params) noexcept;
+inline void GetShaderiv(GLuint shader, GLenum pname, GLint* params) noexcept
+{
+    tDispatch.glGetShaderiv(shader, pname, params);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glGetShaderInfoLog.xhtml
 ///
-void GetShaderInfoLog(GLuint shader, GLsizei maxLength, GLsizei* length, GLchar* infoLog) noexcept;
+inline void GetShaderInfoLog(GLuint shader, GLsizei maxLength, GLsizei* length, GLchar* infoLog) noexcept
+{
+    tDispatch.glGetShaderInfoLog(shader, maxLength, length, infoLog);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glCreateProgram.xhtml
 ///
-LEPONG_NODISCARD GLuint CreateProgram() noexcept;
+LEPONG_NODISCARD inline GLuint CreateProgram() noexcept
+{
+    const auto kProgram = tDispatch.glCreateProgram();
+    Trace::Record(Trace::Call::CreateProgram, kProgram);
+
+    return kProgram;
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glDeleteProgram.xhtml
 ///
-void DeleteProgram(GLuint program) noexcept;
+inline void DeleteProgram(GLuint program) noexcept
+{
+    Trace::Record(Trace::Call::DeleteProgram, program);
+    tDispatch.glDeleteProgram(program);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glAttachShader.xhtml
 ///
-void AttachShader(GLuint program, GLuint shader) noexcept;
+inline void AttachShader(GLuint program, GLuint shader) noexcept
+{
+    Trace::Record(Trace::Call::AttachShader, program, shader);
+    tDispatch.glAttachShader(program, shader);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glLinkProgram.xhtml
 ///
-void LinkProgram(GLuint program) noexcept;
+inline void LinkProgram(GLuint program) noexcept
+{
+    Trace::Record(Trace::Call::LinkProgram, program);
+    tDispatch.glLinkProgram(program);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glGetProgram.xhtml
 ///
-void GetProgramiv(GLuint program, GLenum pname, GLint* params) noexcept;
+inline void GetProgramiv(GLuint program, GLenum pname, GLint* params) noexcept
+{
+    tDispatch.glGetProgramiv(program, pname, params);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glGetProgramInfoLog.xhtml
 ///
-void GetProgramInfoLog(GLuint program, GLsizei maxLength, GLsizei* length, GLchar* infoLog) noexcept;
+inline void GetProgramInfoLog(GLuint program, GLsizei maxLength, GLsizei* length, GLchar* infoLog) noexcept
+{
+    tDispatch.glGetProgramInfoLog(program, maxLength, length, infoLog);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glUseProgram.xhtml
 ///
-void UseProgram(GLuint program) noexcept;
+inline void UseProgram(GLuint program) noexcept
+{
+    Trace::Record(Trace::Call::UseProgram, program);
+    tDispatch.glUseProgram(program);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glGenVertexArrays.xhtml
 ///
-void GenVertexArrays(GLsizei n, GLuint* arrays) noexcept;
+inline void GenVertexArrays(GLsizei n, GLuint* arrays) noexcept
+{
+    tDispatch.glGenVertexArrays(n, arrays);
+    Trace::Record(Trace::Call::GenVertexArrays, Trace::Names{ n, arrays });
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glDeleteVertexArrays.xhtml
 ///
-void DeleteVertexArrays(GLsizei n, const GLuint* arrays) noexcept;
+inline void DeleteVertexArrays(GLsizei n, const GLuint* arrays) noexcept
+{
+    Trace::Record(Trace::Call::DeleteVertexArrays, Trace::Names{ n, arrays });
+    tDispatch.glDeleteVertexArrays(n, arrays);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glBindVertexArray.xhtml
 ///
-void BindVertexArray(GLuint array) noexcept;
+inline void BindVertexArray(GLuint array) noexcept
+{
+    Trace::Record(Trace::Call::BindVertexArray, array);
+    tDispatch.glBindVertexArray(array);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glGenBuffers.xhtml
 ///
-void GenBuffers(GLsizei n, GLuint* buffers) noexcept;
+inline void GenBuffers(GLsizei n, GLuint* buffers) noexcept
+{
+    tDispatch.glGenBuffers(n, buffers);
+    Trace::Record(Trace::Call::GenBuffers, Trace::Names{ n, buffers });
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glDeleteBuffers.xhtml
 ///
-void DeleteBuffers(GLsizei n, const GLuint* buffers) noexcept;
+inline void DeleteBuffers(GLsizei n, const GLuint* buffers) noexcept
+{
+    Trace::Record(Trace::Call::DeleteBuffers, Trace::Names{ n, buffers });
+    tDispatch.glDeleteBuffers(n, buffers);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glBindBuffer.xhtml
 ///
-void BindBuffer(GLenum target, GLuint buffer) noexcept;
+inline void BindBuffer(GLenum target, GLuint buffer) noexcept
+{
+    Trace::Record(Trace::Call::BindBuffer, target, buffer);
+    tDispatch.glBindBuffer(target, buffer);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glBufferData.xhtml
 ///
-void BufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) noexcept;
+inline void BufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) noexcept
+{
+    // Without data, only the size is recorded.
+    const auto kDataSize = static_cast<std::uint32_t>(data ? size : 0u);
+
+    Trace::Record(
+        Trace::Call::BufferData, target, static_cast<std::uint64_t>(size), Trace::Blob{ data, kDataSize }, usage);
+
+    tDispatch.glBufferData(target, size, data, usage);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glBufferSubData.xhtml
+///
+inline void BufferSubData(GLenum target, GLsizeiptr offset, GLsizeiptr size, const void* data) noexcept
+{
+    Trace::Record(
+        Trace::Call::BufferSubData,
+        target, static_cast<std::uint64_t>(offset), Trace::Blob{ data, static_cast<std::uint32_t>(size) });
+
+    tDispatch.glBufferSubData(target, offset, size, data);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glEnableVertexAttribArray.xhtml
 ///
-void EnableVertexAttribArray(GLuint index) noexcept;
+inline void EnableVertexAttribArray(GLuint index) noexcept
+{
+    Trace::Record(Trace::Call::EnableVertexAttribArray, index);
+    tDispatch.glEnableVertexAttribArray(index);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glVertexAttribPointer.xhtml
 ///
-void VertexAttribPointer(
-    GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer) noexcept;
+inline void VertexAttribPointer(
+    GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer) noexcept
+{
+    // The pointer is an offset in the bound buffer.
+    const auto kOffset = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(pointer));
+    Trace::Record(Trace::Call::VertexAttribPointer, index, size, type, normalized, stride, kOffset);
+
+    tDispatch.glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glVertexAttribDivisor.xhtml
+///
+inline void VertexAttribDivisor(GLuint index, GLuint divisor) noexcept
+{
+    Trace::Record(Trace::Call::VertexAttribDivisor, index, divisor);
+    tDispatch.glVertexAttribDivisor(index, divisor);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glDrawElements.xhtml
 ///
-void DrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices) noexcept;
+inline void DrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices) noexcept
+{
+    const auto kOffset = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(indices));
+    Trace::Record(Trace::Call::DrawElements, mode, count, type, kOffset);
+
+    tDispatch.glDrawElements(mode, count, type, indices);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glDrawElementsInstanced.xhtml
+///
+inline void DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instanceCount) noexcept
+{
+    const auto kOffset = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(indices));
+    Trace::Record(Trace::Call::DrawElementsInstanced, mode, count, type, kOffset, instanceCount);
+
+    tDispatch.glDrawElementsInstanced(mode, count, type, indices, instanceCount);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glDrawArrays.xhtml
+///
+inline void DrawArrays(GLenum mode, GLint first, GLsizei count) noexcept
+{
+    Trace::Record(Trace::Call::DrawArrays, mode, first, count);
+    tDispatch.glDrawArrays(mode, first, count);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glGenTextures.xhtml
+///
+inline void GenTextures(GLsizei n, GLuint* textures) noexcept
+{
+    tDispatch.glGenTextures(n, textures);
+    Trace::Record(Trace::Call::GenTextures, Trace::Names{ n, textures });
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glDeleteTextures.xhtml
+///
+inline void DeleteTextures(GLsizei n, const GLuint* textures) noexcept
+{
+    Trace::Record(Trace::Call::DeleteTextures, Trace::Names{ n, textures });
+    tDispatch.glDeleteTextures(n, textures);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glBindTexture.xhtml
+///
+inline void BindTexture(GLenum target, GLuint texture) noexcept
+{
+    Trace::Record(Trace::Call::BindTexture, target, texture);
+    tDispatch.glBindTexture(target, texture);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glActiveTexture.xhtml
+///
+inline void ActiveTexture(GLenum texture) noexcept
+{
+    Trace::Record(Trace::Call::ActiveTexture, texture);
+    tDispatch.glActiveTexture(texture);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glTexImage2D.xhtml
+///
+inline void TexImage2D(
+    GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLint border, GLenum format,
+    GLenum type, const void* data) noexcept
+{
+    // Only 8 bit RGBA pixels are recorded, the other formats are traced without their data.
+    const auto kHasData = data && format == RGBA && type == UnsignedByte;
+    const auto kDataSize = kHasData ? static_cast<std::uint32_t>(width * height * 4) : 0u;
+
+    Trace::Record(
+        Trace::Call::TexImage2D,
+        target, level, internalFormat, width, height, border, format, type, Trace::Blob{ data, kDataSize });
+
+    tDispatch.glTexImage2D(target, level, internalFormat, width, height, border, format, type, data);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glTexParameter.xhtml
+///
+inline void TexParameteri(GLenum target, GLenum pname, GLint param) noexcept
+{
+    Trace::Record(Trace::Call::TexParameteri, target, pname, param);
+    tDispatch.glTexParameteri(target, pname, param);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glGenFramebuffers.xhtml
+///
+inline void GenFramebuffers(GLsizei n, GLuint* framebuffers) noexcept
+{
+    tDispatch.glGenFramebuffers(n, framebuffers);
+    Trace::Record(Trace::Call::GenFramebuffers, Trace::Names{ n, framebuffers });
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glDeleteFramebuffers.xhtml
+///
+inline void DeleteFramebuffers(GLsizei n, const GLuint* framebuffers) noexcept
+{
+    Trace::Record(Trace::Call::DeleteFramebuffers, Trace::Names{ n, framebuffers });
+    tDispatch.glDeleteFramebuffers(n, framebuffers);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glBindFramebuffer.xhtml
+///
+inline void BindFramebuffer(GLenum target, GLuint framebuffer) noexcept
+{
+    Trace::Record(Trace::Call::BindFramebuffer, target, framebuffer);
+    tDispatch.glBindFramebuffer(target, framebuffer);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glFramebufferTexture.xhtml
+///
+inline void FramebufferTexture2D(GLenum target, GLenum attachment, GLenum textureTarget, GLuint texture, GLint level) noexcept
+{
+    Trace::Record(Trace::Call::FramebufferTexture2D, target, attachment, textureTarget, texture, level);
+    tDispatch.glFramebufferTexture2D(target, attachment, textureTarget, texture, level);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glCheckFramebufferStatus.xhtml
+///
+LEPONG_NODISCARD inline GLenum CheckFramebufferStatus(GLenum target) noexcept
+{
+    return tDispatch.glCheckFramebufferStatus(target);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glViewport.xhtml
+///
+inline void Viewport(GLint x, GLint y, GLsizei width, GLsizei height) noexcept
+{
+    Trace::Record(Trace::Call::Viewport, x, y, width, height);
+    tDispatch.glViewport(x, y, width, height);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glGetString.xhtml
 ///
-LEPONG_NODISCARD const GLubyte* GetString(GLenum name) noexcept;
+LEPONG_NODISCARD inline const GLubyte* GetString(GLenum name) noexcept
+{
+    return tDispatch.glGetString(name);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/glClear.xml
 ///
-void Clear(GLbitfield mask) noexcept;
+inline void Clear(GLbitfield mask) noexcept
+{
+    Trace::Record(Trace::Call::Clear, mask);
+    tDispatch.glClear(mask);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glFinish.xhtml
+///
+inline void Finish() noexcept
+{
+    // Not recorded, it doesn't change what is rendered.
+    tDispatch.glFinish();
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glReadPixels.xhtml
+///
+inline void ReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* data) noexcept
+{
+    // Not recorded either, only the replay reads the frames back.
+    tDispatch.glReadPixels(x, y, width, height, format, type, data);
+}
+
+// Queries only measure the rendering, none of them are recorded.
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glGenQueries.xhtml
+///
+inline void GenQueries(GLsizei n, GLuint* ids) noexcept
+{
+    tDispatch.glGenQueries(n, ids);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glDeleteQueries.xhtml
+///
+inline void DeleteQueries(GLsizei n, const GLuint* ids) noexcept
+{
+    tDispatch.glDeleteQueries(n, ids);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glQueryCounter.xhtml
+///
+inline void QueryCounter(GLuint id, GLenum target) noexcept
+{
+    tDispatch.glQueryCounter(id, target);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glGetQueryObject.xhtml
+///
+inline void GetQueryObjectiv(GLuint id, GLenum pname, GLint* params) noexcept
+{
+    tDispatch.glGetQueryObjectiv(id, pname, params);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glGetQueryObject.xhtml
+///
+inline void GetQueryObjectui64v(GLuint id, GLenum pname, GLuint64* params) noexcept
+{
+    tDispatch.glGetQueryObjectui64v(id, pname, params);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glGetUniformLocation.xhtml
 ///
-LEPONG_NODISCARD GLint GetUniformLocation(GLuint program, const GLchar* name) noexcept;
+LEPONG_NODISCARD inline GLint GetUniformLocation(GLuint program, const GLchar* name) noexcept
+{
+    const auto kLocation = tDispatch.glGetUniformLocation(program, name);
+
+    const auto kNameSize = static_cast<std::uint32_t>(std::strlen(name));
+    Trace::Record(Trace::Call::GetUniformLocation, program, Trace::Blob{ name, kNameSize }, kLocation);
+
+    return kLocation;
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glUniform.xhtml
+///
+inline void Uniform2f(GLint location, GLfloat v0, GLfloat v1) noexcept
+{
+    Trace::Record(Trace::Call::Uniform2f, location, v0, v1);
+    tDispatch.glUniform2f(location, v0, v1);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glUniform.xhtml
+///
+inline void Uniform1i(GLint location, GLint v0) noexcept
+{
+    Trace::Record(Trace::Call::Uniform1i, location, v0);
+    tDispatch.glUniform1i(location, v0);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glUniform.xhtml
+///
+inline void Uniform1f(GLint location, GLfloat v0) noexcept
+{
+    Trace::Record(Trace::Call::Uniform1f, location, v0);
+    tDispatch.glUniform1f(location, v0);
+}
 
 ///
 /// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glUniform.xhtml
 ///
-void Uniform2f(GLint location, GLfloat v0, GLfloat v1) noexcept;
+inline void Uniform4fv(GLint location, GLsizei count, const GLfloat* value) noexcept
+{
+    const auto kSize = static_cast<std::uint32_t>(count * 4 * sizeof(GLfloat));
+    Trace::Record(Trace::Call::Uniform4fv, location, count, Trace::Blob{ value, kSize });
+
+    tDispatch.glUniform4fv(location, count, value);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glGetUniformBlockIndex.xhtml
+///
+LEPONG_NODISCARD inline GLuint GetUniformBlockIndex(GLuint program, const GLchar* name) noexcept
+{
+    const auto kIndex = tDispatch.glGetUniformBlockIndex(program, name);
+
+    const auto kNameSize = static_cast<std::uint32_t>(std::strlen(name));
+    Trace::Record(Trace::Call::GetUniformBlockIndex, program, Trace::Blob{ name, kNameSize }, kIndex);
+
+    return kIndex;
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glUniformBlockBinding.xhtml
+///
+inline void UniformBlockBinding(GLuint program, GLuint blockIndex, GLuint blockBinding) noexcept
+{
+    Trace::Record(Trace::Call::UniformBlockBinding, program, blockIndex, blockBinding);
+    tDispatch.glUniformBlockBinding(program, blockIndex, blockBinding);
+}
+
+///
+/// https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glBindBufferBase.xhtml
+///
+inline void BindBufferBase(GLenum target, GLuint index, GLuint buffer) noexcept
+{
+    Trace::Record(Trace::Call::BindBufferBase, target, index, buffer);
+    tDispatch.glBindBufferBase(target, index, buffer);
+}
 
 } // namespace lepong::Graphics::GL
@@ -0,0 +1,77 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "lepong/Attribute.h"
+
+namespace lepong::Graphics::GpuTimer
+{
+
+// Measures how long the GPU spends on each render pass, to tell whether frames are GPU bound.<br>
+// A timestamp query is issued when a frame begins and at the end of every pass, a pass lasts from the previous
+// timestamp to its own. The queries of the last skLatency frames are kept in a ring, a frame's results are read back
+// when its slot is reused. The results are never waited for: a frame whose results are not available yet is dropped.<br>
+// The durations are recorded in the profiler's Gpu timers, the number of dropped frames is logged at cleanup. Drops
+// in every frame mean the driver needs a longer skLatency.
+
+///
+/// The passes are measured in the order they end, a pass may be skipped.
+///
+enum class Pass : unsigned
+{
+    Clear,
+    Post,
+    Ball,
+    Paddles,
+
+    // The grid viewer and the analytic renderer draw the whole frame in a single pass.
+    Scene,
+
+    // Stretches the scene over the window when its resolution is scaled.
+    Upscale,
+
+    Swap,
+    Count
+};
+
+// How many frames the results are read back after.
+static constexpr unsigned skLatency = 4u;
+
+// The timestamps of a frame, its beginning included.
+static constexpr unsigned skMaxTimestamps = 16u;
+
+///
+/// Creates the queries, the current context is used.<br>
+/// If the timer is already initialized, this function returns false.
+///
+/// \return Whether the timer was successfully initialized.
+///
+LEPONG_NODISCARD bool Init() noexcept;
+
+///
+/// Destroys the queries and logs how many frames were dropped.
+///
+void Cleanup() noexcept;
+
+///
+/// Records the durations of the oldest frame in the ring if they are available, then starts measuring a new frame.<br>
+/// Must be called before anything is rendered.
+///
+void BeginFrame() noexcept;
+
+///
+/// Marks the end of a pass. Once a frame has skMaxTimestamps timestamps, this function does nothing.
+///
+void EndPass(Pass pass) noexcept;
+
+///
+/// \return How long the GPU took to render the last frame that was read back, in nanoseconds.<br>
+/// Until a frame is read back, this function returns 0.
+///
+LEPONG_NODISCARD std::uint64_t GetFrameTime() noexcept;
+
+} // namespace lepong::Graphics::GpuTimer
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "lepong/Attribute.h"
+#include "lepong/Math/Vector2.h"
 
 #include "GL.h"
 
@@ -43,9 +44,19 @@ LEPONG_NODISCARD GLuint CreateShaderFromSource(GLenum type, const char* source)
 /// Creates a program using the provided vertex and fragment shaders.<br>
 /// This function does not check if the provided shaders are valid vertex and fragment shaders.<br>
 ///
+/// If the program declares the frame uniform block, the block is bound to the frame uniform buffer.<br>
+///
 /// If the shaders are 0, the return value is 0.<br>
 /// If linking fails, the return value is 0 and the error is automatically logged.
 ///
 LEPONG_NODISCARD GLuint CreateProgramFromShaders(GLuint vert, GLuint frag) noexcept;
 
+///
+/// Creates a texture of the provided size and a framebuffer that renders to it, the texture is filtered linearly.<br>
+/// The framebuffer is left bound.
+///
+/// \return Whether the framebuffer is complete.
+///
+LEPONG_NODISCARD bool MakeRenderTarget(GLuint& texture, GLuint& framebuffer, const Vector2i& size) noexcept;
+
 } // namespace lepong::Graphics
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <vector>
 
 #include "Graphics.h"
@@ -29,6 +31,47 @@ public:
     }
 };
 
+///
+/// A view of contiguous values, we don't have std::span yet.
+///
+template<typename T>
+struct Span
+{
+    const T* data = nullptr;
+    std::size_t size = 0u;
+
+public:
+    constexpr Span() noexcept = default;
+
+    constexpr Span(const T* first, std::size_t count) noexcept
+        : data(first), size(count)
+    {
+    }
+
+    template<std::size_t Size>
+    constexpr Span(const T (&array)[Size]) noexcept
+        : data(array), size(Size)
+    {
+    }
+
+    template<std::size_t Size>
+    constexpr Span(const std::array<T, Size>& array) noexcept
+        : data(array.data()), size(Size)
+    {
+    }
+
+    Span(const std::vector<T>& vector) noexcept
+        : data(vector.data()), size(vector.size())
+    {
+    }
+
+public:
+    LEPONG_NODISCARD constexpr const T& operator[](std::size_t index) const noexcept
+    {
+        return data[index];
+    }
+};
+
 ///
 /// Mesh vertices.
 ///
@@ -40,20 +83,91 @@ using Vertices = std::vector<GLfloat>;
 using Indices = std::vector<GLuint>;
 
 ///
-/// Mesh vertex layout. Yeah.
+/// Mesh vertex layout. Yeah.<br>
+/// Each value is the number of floats of an attribute, attributes are interleaved.
 ///
 using VertexLayout = std::vector<GLuint>;
 
+///
+/// \return The size of a vertex with the provided layout, in floats.
+///
+LEPONG_NODISCARD constexpr GLuint GetVertexStride(Span<GLuint> vertexLayout) noexcept
+{
+    GLuint stride = 0u;
+
+    for (std::size_t i = 0; i < vertexLayout.size; ++i)
+    {
+        stride += vertexLayout[i];
+    }
+
+    return stride;
+}
+
+///
+/// \return The offset of the provided attribute in a vertex with the provided layout, in floats.
+///
+LEPONG_NODISCARD constexpr GLuint GetAttributeOffset(Span<GLuint> vertexLayout, std::size_t attribute) noexcept
+{
+    return GetVertexStride({ vertexLayout.data, attribute });
+}
+
+///
+/// A mesh known at compile time. No heap memory is needed to create it.
+///
+template<std::size_t NumVertexValues, std::size_t NumIndices, std::size_t NumAttributes>
+struct MeshDescription
+{
+    std::array<GLfloat, NumVertexValues> vertices;
+    std::array<GLuint, NumIndices> indices;
+    std::array<GLuint, NumAttributes> vertexLayout;
+
+public:
+    LEPONG_NODISCARD constexpr GLuint GetVertexStride() const noexcept
+    {
+        return Graphics::GetVertexStride(vertexLayout);
+    }
+
+    LEPONG_NODISCARD constexpr bool IsValid() const noexcept
+    {
+        const auto kStride = GetVertexStride();
+        return kStride && NumVertexValues % kStride == 0u && NumIndices % 3u == 0u;
+    }
+};
+
 ///
 /// Creates a mesh with the provided data.
 ///
-LEPONG_NODISCARD Mesh MakeMesh(const Vertices& vertices, const Indices& indices) noexcept;
+LEPONG_NODISCARD Mesh MakeMesh(Span<GLfloat> vertices, Span<GLuint> indices) noexcept;
 
 ///
 /// Sets the provided mesh's vertex layout.<br>
 /// If the provided mesh is not valid, this function does nothing.
 ///
-void SetMeshVertexLayout(const Mesh& mesh, const VertexLayout& vertexLayout) noexcept;
+void SetMeshVertexLayout(const Mesh& mesh, Span<GLuint> vertexLayout) noexcept;
+
+///
+/// Creates a mesh from its compile time description, with its vertex layout set.
+///
+template<std::size_t NumVertexValues, std::size_t NumIndices, std::size_t NumAttributes>
+LEPONG_NODISCARD Mesh MakeMesh(const MeshDescription<NumVertexValues, NumIndices, NumAttributes>& description) noexcept
+{
+    const auto kMesh = MakeMesh(description.vertices, description.indices);
+
+    if (kMesh.va)
+    {
+        SetMeshVertexLayout(kMesh, description.vertexLayout);
+    }
+
+    return kMesh;
+}
+
+///
+/// Sources per instance attributes of the provided mesh from a buffer, starting at the provided attribute index.<br>
+/// Instance attributes are interleaved like vertex attributes, the first instance starts at <i>offset</i> bytes.<br>
+/// If the provided mesh is not valid, this function does nothing.
+///
+void SetMeshInstanceLayout(
+    const Mesh& mesh, GLuint buffer, GLsizeiptr offset, GLuint firstAttribute, Span<GLuint> instanceLayout) noexcept;
 
 ///
 /// Draws the provided mesh using the current program.<br>
@@ -61,6 +175,12 @@ void SetMeshVertexLayout(const Mesh& mesh, const VertexLayout& vertexLayout) noe
 ///
 void DrawMesh(const Mesh& mesh) noexcept;
 
+///
+/// Draws many instances of the provided mesh in a single call using the current program.<br>
+/// If the provided mesh is not valid, this function does nothing.
+///
+void DrawMeshInstanced(const Mesh& mesh, GLsizei numInstances) noexcept;
+
 ///
 /// Destroys resources associated with the provided mesh.<br>
 /// If the provided mesh is not valid, this function does nothing.
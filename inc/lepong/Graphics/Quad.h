@@ -24,10 +24,9 @@ LEPONG_NODISCARD Mesh MakeTexturedQuad() noexcept;
 ///
 /// Creates a quad vertex shader.<br><br>
 ///
-/// This vertex shader requires the following uniforms to be loaded:<br>
-/// - <b>uWinSize</b>: The size of the render window in pixels.<br>
-/// - <b>uSize</b>: The size of the quad in pixels.<br>
-/// - <b>uPosition</b>: The position of the quad in pixels.<br><br>
+/// This vertex shader reads the frame uniform block and requires the following uniforms to be loaded:<br>
+/// - <b>uSize</b>: The size of the quad in world units.<br>
+/// - <b>uPosition</b>: The position of the quad in world units.<br><br>
 ///
 /// Rendering is pretty simple, this is Pong after all.
 ///
@@ -38,6 +37,23 @@ LEPONG_NODISCARD GLuint MakeQuadVertexShader() noexcept;
 ///
 LEPONG_NODISCARD GLuint MakeTexturedQuadVertexShader() noexcept;
 
+// Where instanced quad vertex shaders read their instance, after the vertex attributes.
+static constexpr GLuint skQuadInstanceAttribute = 2u;
+
+///
+/// Creates an instanced quad vertex shader.<br><br>
+///
+/// Each instance is a vec4 read from attribute <i>skQuadInstanceAttribute</i>: the position of the quad in world
+/// units followed by its size in world units.<br>
+/// This vertex shader reads the frame uniform block.
+///
+LEPONG_NODISCARD GLuint MakeInstancedQuadVertexShader() noexcept;
+
+///
+/// Same as above but also passes texture data to the fragment shader.
+///
+LEPONG_NODISCARD GLuint MakeInstancedTexturedQuadVertexShader() noexcept;
+
 ///
 /// Draws a quad using the provided program.<br>
 /// This function expects the program to be using a vertex shader created with <i>MakeQuadVertexShader</i>.<br>
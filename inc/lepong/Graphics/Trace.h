@@ -0,0 +1,252 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include "lepong/Attribute.h"
+#include "lepong/Math/Vector2.h"
+
+#include "GLFunctions.h"
+
+namespace lepong::Graphics::Trace
+{
+
+// Records every call made through the OpenGL interface to a compact binary file, so the render path can be replayed
+// and benchmarked without the game logic by the lepong_glreplay tool.<br>
+// A trace is a TraceHeader followed by commands. A command is its Call as a single byte followed by its arguments,
+// packed without padding as described by skCallSignatures.<br>
+// Queries are not recorded, except the ones whose result later calls depend on: object creation and uniform
+// locations. Their results are recorded so the replayer can map them to the objects it creates.
+
+///
+/// Set this environment variable to the path of the trace file to record one.
+///
+static constexpr const char* skSelectionVariable = "LEPONG_GL_TRACE";
+
+static constexpr std::uint32_t skMagic = 0x54474C4Cu; // "LLGT".
+static constexpr std::uint32_t skVersion = 2u;
+
+struct TraceHeader
+{
+    std::uint32_t magic = 0u;
+    std::uint32_t version = 0u;
+
+    // The size of the window the trace was recorded with.
+    std::int32_t winSizeX = 0;
+    std::int32_t winSizeY = 0;
+};
+
+static_assert(sizeof(TraceHeader) == 16);
+
+enum class Call : std::uint8_t
+{
+    FrameEnd,
+    CreateShader,
+    DeleteShader,
+    ShaderSource,
+    CompileShader,
+    CreateProgram,
+    DeleteProgram,
+    AttachShader,
+    LinkProgram,
+    UseProgram,
+    GenVertexArrays,
+    DeleteVertexArrays,
+    BindVertexArray,
+    GenBuffers,
+    DeleteBuffers,
+    BindBuffer,
+    BufferData,
+    BufferSubData,
+    EnableVertexAttribArray,
+    VertexAttribPointer,
+    VertexAttribDivisor,
+    DrawElements,
+    DrawElementsInstanced,
+    DrawArrays,
+    GenTextures,
+    DeleteTextures,
+    BindTexture,
+    ActiveTexture,
+    TexImage2D,
+    TexParameteri,
+    GenFramebuffers,
+    DeleteFramebuffers,
+    BindFramebuffer,
+    FramebufferTexture2D,
+    Viewport,
+    Clear,
+    GetUniformLocation,
+    Uniform2f,
+    Uniform1i,
+    Uniform1f,
+    Uniform4fv,
+    GetUniformBlockIndex,
+    UniformBlockBinding,
+    BindBufferBase,
+    Count
+};
+
+// The arguments of each call, one character per argument:
+// e: a GLenum, u: a 32 bit unsigned integer, i: a 32 bit signed integer, f: a float, b: a GLboolean,
+// q: a 64 bit unsigned integer for sizes and buffer offsets,
+// x: a blob, its size as a 32 bit unsigned integer followed by its bytes, s: a blob holding a string,
+// N: a count as a 32 bit unsigned integer followed by as many 32 bit object names,
+// X: a count as a 32 bit unsigned integer followed by as many blobs.<br>
+// Creation calls, GetUniformLocation and GetUniformBlockIndex record their result right after the arguments they were
+// called with.
+static constexpr const char* skCallSignatures[] =
+{
+    "",          // FrameEnd.
+    "eu",        // CreateShader: type, shader.
+    "u",         // DeleteShader.
+    "uX",        // ShaderSource: shader, sources.
+    "u",         // CompileShader.
+    "u",         // CreateProgram: program.
+    "u",         // DeleteProgram.
+    "uu",        // AttachShader.
+    "u",         // LinkProgram.
+    "u",         // UseProgram.
+    "N",         // GenVertexArrays.
+    "N",         // DeleteVertexArrays.
+    "u",         // BindVertexArray.
+    "N",         // GenBuffers.
+    "N",         // DeleteBuffers.
+    "eu",        // BindBuffer.
+    "eqxe",      // BufferData: target, size, data, usage.
+    "eqx",       // BufferSubData: target, offset, data.
+    "u",         // EnableVertexAttribArray.
+    "uiebiq",    // VertexAttribPointer.
+    "uu",        // VertexAttribDivisor.
+    "eieq",      // DrawElements.
+    "eieqi",     // DrawElementsInstanced.
+    "eii",       // DrawArrays.
+    "N",         // GenTextures.
+    "N",         // DeleteTextures.
+    "eu",        // BindTexture.
+    "e",         // ActiveTexture.
+    "eiiiiieex", // TexImage2D.
+    "eei",       // TexParameteri.
+    "N",         // GenFramebuffers.
+    "N",         // DeleteFramebuffers.
+    "eu",        // BindFramebuffer.
+    "eeeui",     // FramebufferTexture2D.
+    "iiii",      // Viewport.
+    "u",         // Clear.
+    "usi",       // GetUniformLocation: program, name, location.
+    "iff",       // Uniform2f.
+    "ii",        // Uniform1i.
+    "if",        // Uniform1f.
+    "iix",       // Uniform4fv: location, count, values.
+    "usu",       // GetUniformBlockIndex: program, name, index.
+    "uuu",       // UniformBlockBinding: program, index, binding.
+    "euu",       // BindBufferBase: target, index, buffer.
+};
+
+static_assert(std::size(skCallSignatures) == static_cast<std::size_t>(Call::Count));
+
+// Read by every wrapper of the OpenGL interface, only StartRecording and StopRecording change it.
+inline bool sRecording = false;
+
+///
+/// A blob argument.
+///
+struct Blob
+{
+    const void* data = nullptr;
+    std::uint32_t size = 0u;
+};
+
+///
+/// An array of object names argument.
+///
+struct Names
+{
+    GLsizei count = 0;
+    const GLuint* names = nullptr;
+};
+
+///
+/// The sources of a shader, as passed to ShaderSource.
+///
+struct Sources
+{
+    GLsizei count = 0;
+    const GLchar* const* strings = nullptr;
+
+    // Null if every string is null terminated.
+    const GLint* lengths = nullptr;
+};
+
+///
+/// \return Whether a trace was requested with the environment variable.
+///
+LEPONG_NODISCARD bool IsSelected() noexcept;
+
+///
+/// Creates the trace file named by the environment variable and starts recording the OpenGL calls.<br>
+/// If a trace is already being recorded, this function returns false.
+///
+/// \param winSize The size of the window the calls render to.
+///
+/// \return Whether the trace file was created.
+///
+LEPONG_NODISCARD bool StartRecording(const Vector2i& winSize) noexcept;
+
+///
+/// Closes the trace file. If no trace is being recorded, this function does nothing.
+///
+void StopRecording() noexcept;
+
+///
+/// \return Whether the OpenGL calls are being recorded.
+///
+LEPONG_NODISCARD inline bool IsRecording() noexcept
+{
+    return sRecording;
+}
+
+///
+/// Marks the end of a frame, the replayer swaps buffers and measures frame times there.
+///
+void RecordFrameEnd() noexcept;
+
+///
+/// Appends raw bytes to the trace file.
+///
+void Write(const void* data, std::size_t size) noexcept;
+
+///
+/// Appends an argument to the trace file, encoded as described by skCallSignatures.
+///
+void WriteArgument(const Blob& blob) noexcept;
+void WriteArgument(const Names& names) noexcept;
+void WriteArgument(const Sources& sources) noexcept;
+
+template<typename T>
+void WriteArgument(T value) noexcept
+{
+    static_assert(std::is_arithmetic_v<T> && (sizeof(T) == 1 || sizeof(T) == 4 || sizeof(T) == 8));
+    Write(&value, sizeof(T));
+}
+
+///
+/// Records a command. The arguments must match the call's signature.<br>
+/// If no trace is being recorded, this function does nothing.
+///
+template<typename... Args>
+void Record(Call call, const Args&... args) noexcept
+{
+    if (IsRecording())
+    {
+        WriteArgument(static_cast<std::uint8_t>(call));
+        (WriteArgument(args), ...);
+    }
+}
+
+} // namespace lepong::Graphics::Trace
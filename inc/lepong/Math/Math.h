@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "lepong/Attribute.h"
 
 #include "Vector2.h"
@@ -11,6 +13,18 @@
 namespace lepong
 {
 
+///
+/// Seeds the calling thread's random number generator.<br>
+/// A seed of 0 is replaced by a fixed non zero value.
+///
+void SeedRandom(std::uint32_t seed) noexcept;
+
+///
+/// \return The internal state of the random number generator.<br>
+/// This is part of the game state, two games with the same random state and inputs play out the same way.
+///
+LEPONG_NODISCARD std::uint32_t GetRandomState() noexcept;
+
 ///
 /// \return Randomly <code>1</code> or <code>-1</code>.
 ///
@@ -0,0 +1,96 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "lepong/Attribute.h"
+
+namespace lepong::Allocations
+{
+
+// Every operator new is counted, and so are malloc and its aligned forms where they can be hooked (glibc and the MSVC
+// debug CRT).<br>
+// The game's hot path must not allocate once warmed up: allocations made in a hot section after
+// skWarmUpFrames frames are violations. In strict mode the first violation aborts the process.
+
+enum class Phase : unsigned
+{
+    Init,
+    Frame,
+    Cleanup,
+    Count
+};
+
+// Lazily initialized resources (file buffers, driver state...) get a few frames to settle.
+static constexpr std::uint64_t skWarmUpFrames = 120u;
+
+///
+/// Strict mode is enabled by setting this environment variable to 1.
+///
+static constexpr const char* skStrictModeVariable = "LEPONG_STRICT_ALLOCATIONS";
+
+struct PhaseCounters
+{
+    std::atomic<std::uint64_t> numAllocations = 0u;
+    std::atomic<std::uint64_t> numBytes = 0u;
+    std::atomic<std::uint64_t> numFrees = 0u;
+};
+
+///
+/// Reads the strict mode setting.<br>
+/// If the allocation tracker is already initialized, this function returns false.
+///
+/// \return Whether the allocation tracker was successfully initialized.
+///
+LEPONG_NODISCARD bool Init() noexcept;
+
+///
+/// Logs the allocation report.
+///
+void Cleanup() noexcept;
+
+///
+/// Sets the phase new allocations are counted in.
+///
+void SetPhase(Phase phase) noexcept;
+
+///
+/// Enables or disables strict mode, for headless tests and benchmarks that don't go through Init.
+///
+void SetStrict(bool strict) noexcept;
+
+///
+/// Marks the start of code the calling thread must run without allocating. Hot sections can be nested.
+///
+void BeginHotSection() noexcept;
+
+///
+/// Marks the end of the calling thread's current hot section.
+///
+void EndHotSection() noexcept;
+
+///
+/// Counts a frame toward the warm-up.
+///
+void OnFrameEnd() noexcept;
+
+///
+/// \return The allocations made in the provided phase.
+///
+LEPONG_NODISCARD const PhaseCounters& GetPhaseCounters(Phase phase) noexcept;
+
+///
+/// \return The number of allocations made in hot sections after the warm-up.
+///
+LEPONG_NODISCARD std::uint64_t GetNumViolations() noexcept;
+
+///
+/// Logs the counters of every phase and the hot section violations.
+///
+void LogReport() noexcept;
+
+} // namespace lepong::Allocations
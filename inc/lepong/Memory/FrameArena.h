@@ -0,0 +1,159 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "lepong/Attribute.h"
+
+namespace lepong::FrameArena
+{
+
+// Transient per-frame memory. An arena has two buffers: one is bumped into during the current frame while
+// the other still holds the previous frame's data, so it can be read one frame later.<br>
+// Nothing allocated from an arena is ever destroyed, only trivially destructible types can be put in it.
+
+static constexpr std::size_t skMainArenaSize = 1u << 20u;
+
+// Arenas with the same name share a line of the report. Names past this count are still usable, their arenas are
+// just not in the report.
+static constexpr unsigned skMaxReportedArenas = 64u;
+
+enum class OverflowPolicy
+{
+    // The allocation returns nullptr and the overflow is counted.
+    ReturnNull,
+
+    // The process is aborted, for tests and benchmarks sizing their arenas.
+    Abort
+};
+
+struct Arena
+{
+    const char* name = nullptr;
+
+    std::uint8_t* buffers[2] = { nullptr, nullptr };
+    std::size_t capacity = 0u;
+
+    unsigned current = 0u;
+    std::size_t offset = 0u;
+
+    OverflowPolicy overflowPolicy = OverflowPolicy::ReturnNull;
+
+    // Statistics.
+    std::size_t highWaterMark = 0u;
+    std::uint64_t numOverflows = 0u;
+
+    LEPONG_NODISCARD bool IsValid() const noexcept
+    {
+        return buffers[0] && buffers[1];
+    }
+};
+
+///
+/// Creates the main thread's arena and binds it.<br>
+/// If the frame arenas are already initialized, this function returns false.
+///
+/// \return Whether the frame arenas were successfully initialized.
+///
+LEPONG_NODISCARD bool Init() noexcept;
+
+///
+/// Destroys the main thread's arena and logs the report.
+///
+void Cleanup() noexcept;
+
+///
+/// Creates an arena with two buffers of the provided size.<br>
+/// The arena's statistics are added to the report when it is destroyed, its name must outlive the report.
+///
+LEPONG_NODISCARD Arena MakeArena(const char* name, std::size_t capacity, OverflowPolicy overflowPolicy) noexcept;
+
+///
+/// Adds the arena's statistics to the report and frees its buffers.
+///
+void DestroyArena(Arena& arena) noexcept;
+
+///
+/// Makes the provided arena the calling thread's arena. Worker threads should each bind their own.
+///
+void BindThreadArena(Arena* arena) noexcept;
+
+///
+/// \return The calling thread's arena, or nullptr if none is bound.
+///
+LEPONG_NODISCARD Arena* GetThreadArena() noexcept;
+
+///
+/// Switches the calling thread's arena to its other buffer and clears it.<br>
+/// Memory from the previous frame stays valid until the next call.
+///
+void BeginFrame() noexcept;
+
+///
+/// Switches the provided arena to its other buffer and clears it.
+///
+void BeginFrame(Arena& arena) noexcept;
+
+///
+/// Logs the high-water mark and overflow count of every destroyed arena, by name.
+///
+void LogReport() noexcept;
+
+///
+/// The overflow path of Allocate, kept out of line.
+///
+LEPONG_NODISCARD void* Overflow(Arena& arena) noexcept;
+
+///
+/// \return <i>size</i> bytes aligned to <i>alignment</i>, which must be a power of two.
+///
+LEPONG_NODISCARD inline void* Allocate(Arena& arena, std::size_t size, std::size_t alignment) noexcept
+{
+    const auto kBuffer = arena.buffers[arena.current];
+    const auto kAddress = reinterpret_cast<std::uintptr_t>(kBuffer) + arena.offset;
+
+    const auto kStart = (kAddress + alignment - 1u) & ~static_cast<std::uintptr_t>(alignment - 1u);
+    const auto kEnd = kStart - reinterpret_cast<std::uintptr_t>(kBuffer) + size;
+
+    if (kEnd > arena.capacity)
+    {
+        return Overflow(arena);
+    }
+
+    arena.offset = kEnd;
+    arena.highWaterMark = kEnd > arena.highWaterMark ? kEnd : arena.highWaterMark;
+
+    return reinterpret_cast<void*>(kStart);
+}
+
+///
+/// \return Uninitialized storage for <i>count</i> objects.
+///
+template<typename T>
+LEPONG_NODISCARD T* AllocateArray(Arena& arena, std::size_t count) noexcept
+{
+    static_assert(std::is_trivially_destructible_v<T>, "Arena objects are never destroyed");
+
+    return static_cast<T*>(Allocate(arena, sizeof(T) * count, alignof(T)));
+}
+
+///
+/// \return An object constructed in the arena, or nullptr on overflow.
+///
+template<typename T, typename... Args>
+LEPONG_NODISCARD T* New(Arena& arena, Args&&... args) noexcept
+{
+    static_assert(std::is_trivially_destructible_v<T>, "Arena objects are never destroyed");
+
+    const auto kMemory = Allocate(arena, sizeof(T), alignof(T));
+    return kMemory ? new (kMemory) T{ std::forward<Args>(args)... } : nullptr;
+}
+
+} // namespace lepong::FrameArena
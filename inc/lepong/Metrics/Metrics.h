@@ -0,0 +1,107 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "lepong/Attribute.h"
+#include "lepong/Time/Histogram.h"
+
+namespace lepong::Metrics
+{
+
+// The metrics region is a file mapped by every running instance and by monitoring tools.<br>
+// Each instance owns a slot that only it writes to, with relaxed atomics so readers never block it.
+
+static constexpr std::uint32_t skRegionMagic = 0x544D4C4Cu; // "LLMT".
+static constexpr std::uint32_t skRegionVersion = 1u;
+
+static constexpr unsigned skMaxInstances = 64u;
+
+///
+/// A slot is considered abandoned when its heartbeat is older than this, in milliseconds.
+///
+static constexpr std::uint64_t skHeartbeatTimeout = 5000u;
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Atomics must be lock free to be shared");
+
+struct alignas(64) InstanceMetrics
+{
+    // 0 when the slot is free.
+    std::atomic<std::uint32_t> processId = 0u;
+
+    // System uptime in milliseconds at the last frame, 0 when the slot is free.
+    std::atomic<std::uint64_t> heartbeat = 0u;
+
+    // Counters.
+    std::atomic<std::uint64_t> numFrames = 0u;
+    std::atomic<std::uint64_t> numTicks = 0u;
+    std::atomic<std::uint64_t> numMatches = 0u;
+
+    // Gauges.
+    std::atomic<std::uint32_t> playerScores[2] = {};
+
+    // Histograms, in nanoseconds.
+    Time::Histogram frameTimes;
+    Time::Histogram tickTimes;
+};
+
+struct Region
+{
+    std::atomic<std::uint32_t> magic = 0u;
+    std::uint32_t version = 0u;
+    std::uint32_t numSlots = 0u;
+    std::uint32_t slotSize = 0u;
+
+    InstanceMetrics slots[skMaxInstances];
+};
+
+///
+/// Builds the path of the file backing the metrics region.
+///
+void GetRegionPath(char* path, std::size_t size) noexcept;
+
+///
+/// \return The system uptime in milliseconds, comparable between processes.
+///
+LEPONG_NODISCARD std::uint64_t GetHeartbeatTime() noexcept;
+
+///
+/// Maps the metrics region and claims a slot for this instance.<br>
+/// If the region can't be used, metrics are kept in process memory and this function still succeeds.<br>
+/// If the metrics system is already initialized, this function returns false.
+///
+/// \return Whether the metrics system was successfully initialized.
+///
+LEPONG_NODISCARD bool Init() noexcept;
+
+///
+/// Releases this instance's slot and unmaps the region.
+///
+void Cleanup() noexcept;
+
+///
+/// Records a frame and refreshes the heartbeat.
+///
+void RecordFrame(std::uint64_t frameNanoseconds) noexcept;
+
+///
+/// Records a game update.
+///
+void RecordTick(std::uint64_t tickNanoseconds) noexcept;
+
+///
+/// Records a finished match.
+///
+void RecordMatch() noexcept;
+
+///
+/// Publishes the current scores.
+///
+void SetScores(unsigned player1Score, unsigned player2Score) noexcept;
+
+} // namespace lepong::Metrics
@@ -0,0 +1,207 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator> // For std::size.
+#include <vector>
+
+#include "lepong/Attribute.h"
+#include "lepong/FileMapping.h"
+
+#include "Replay.h"
+
+namespace lepong::Replay
+{
+
+// Archive layout.
+// Replay blobs are appended to segment files. The index file starts with an <code>IndexHeader</code> followed by
+// blocks of <code>skIndexBlockSize</code> matches. Inside a block every column is stored contiguously so that
+// scanning a column never touches the others.
+
+static constexpr auto skArchiveDirectory = "replays";
+
+static constexpr std::uint32_t skIndexMagic = 0x58494C4Cu; // "LLIX".
+static constexpr std::uint32_t skIndexVersion = 1u;
+
+static constexpr std::uint32_t skIndexBlockSize = 4096u;
+
+///
+/// Segments are not appended to once they get bigger than this.
+///
+static constexpr std::uint64_t skMaxSegmentSize = 1ull << 30u;
+
+struct IndexHeader
+{
+    std::uint32_t magic = skIndexMagic;
+    std::uint32_t version = skIndexVersion;
+
+    ///
+    /// Only the first <i>numMatches</i> rows are valid, this is updated last when a match is added.
+    ///
+    std::uint32_t numMatches = 0u;
+    std::uint32_t numSegments = 0u;
+};
+
+///
+/// The index columns. 64 bit columns come first to keep every column aligned.
+///
+enum class Column : unsigned
+{
+    BlobOffset,      // std::uint64_t, offset of the blob in its segment.
+    BlobSize,        // std::uint64_t, size of the blob including its header.
+    Seed,            // std::uint32_t
+    Segment,         // std::uint32_t
+    NumTicks,        // std::uint32_t
+    Duration,        // float, in seconds.
+    Player1Score,    // std::uint32_t
+    Player2Score,    // std::uint32_t
+    NumRallies,      // std::uint32_t
+    NumPaddleHits,   // std::uint32_t
+    Count
+};
+
+static constexpr std::size_t skColumnWidths[] = { 8, 8, 4, 4, 4, 4, 4, 4, 4, 4 };
+
+static_assert(std::size(skColumnWidths) == static_cast<std::size_t>(Column::Count));
+
+///
+/// \return The offset of the provided column from the start of a block.
+///
+LEPONG_NODISCARD constexpr std::size_t GetColumnOffset(Column column) noexcept
+{
+    std::size_t offset = 0;
+
+    for (unsigned i = 0; i < static_cast<unsigned>(column); ++i)
+    {
+        offset += skColumnWidths[i] * skIndexBlockSize;
+    }
+
+    return offset;
+}
+
+static constexpr auto skIndexBlockBytes = GetColumnOffset(Column::Count);
+
+///
+/// \return The offset of the cell of the provided match and column from the start of the index file.
+///
+LEPONG_NODISCARD constexpr std::size_t GetIndexCellOffset(std::uint32_t match, Column column) noexcept
+{
+    const auto kBlock = match / skIndexBlockSize;
+    const auto kRow = match % skIndexBlockSize;
+
+    return
+        sizeof(IndexHeader) +
+        kBlock * skIndexBlockBytes +
+        GetColumnOffset(column) +
+        kRow * skColumnWidths[static_cast<unsigned>(column)];
+}
+
+///
+/// Builds the path of the provided segment file.
+///
+void GetSegmentPath(char* path, std::size_t size, std::uint32_t segment) noexcept;
+
+///
+/// Builds the path of the index file.
+///
+void GetIndexPath(char* path, std::size_t size) noexcept;
+
+///
+/// A read only view of the archive.
+///
+struct ArchiveReader
+{
+    FileMapping::Mapping index;
+
+    // The number of matches when the archive was opened. The game can keep appending to the index, its header isn't
+    // read again so that every access stays inside the mapping.
+    std::uint32_t numMatches = 0u;
+
+    // Segments are mapped the first time a replay is loaded from them.
+    std::vector<FileMapping::Mapping> segments;
+
+public:
+    LEPONG_NODISCARD constexpr bool IsValid() const noexcept
+    {
+        return index.IsValid();
+    }
+};
+
+///
+/// A replay loaded from the archive. The data points into the archive reader's mappings.
+///
+struct ReplayView
+{
+    const BlobHeader* header = nullptr;
+    const Record* records = nullptr;
+    std::size_t numRecords = 0;
+
+public:
+    LEPONG_NODISCARD constexpr bool IsValid() const noexcept
+    {
+        return header;
+    }
+};
+
+///
+/// Maps the archive index for reading. The replay blobs are not touched.
+///
+/// \return The new reader, not closing it results in a resource leak.
+///
+LEPONG_NODISCARD ArchiveReader OpenArchive() noexcept;
+
+///
+/// Unmaps everything the provided reader mapped.
+///
+void CloseArchive(ArchiveReader& reader) noexcept;
+
+///
+/// \return The number of matches in the archive at the time it was opened.
+///
+LEPONG_NODISCARD std::uint32_t GetNumMatches(const ArchiveReader& reader) noexcept;
+
+///
+/// \return The number of valid rows in the provided index block.
+///
+LEPONG_NODISCARD std::uint32_t GetNumBlockRows(const ArchiveReader& reader, std::uint32_t block) noexcept;
+
+///
+/// \return A pointer to the provided column of the provided index block.<br>
+/// If the block doesn't exist or <i>T</i> doesn't have the width of the column, this function returns
+/// <code>nullptr</code>.
+///
+template<typename T>
+LEPONG_NODISCARD const T* GetColumn(const ArchiveReader& reader, std::uint32_t block, Column column) noexcept
+{
+    const auto kMatch = block * skIndexBlockSize;
+
+    if (sizeof(T) != skColumnWidths[static_cast<unsigned>(column)] || kMatch >= GetNumMatches(reader))
+    {
+        return nullptr;
+    }
+
+    const auto kData = static_cast<const unsigned char*>(reader.index.data);
+    return reinterpret_cast<const T*>(kData + GetIndexCellOffset(kMatch, column));
+}
+
+///
+/// \return The value of the provided cell, or a default value if the match was not in the archive when it was opened.
+///
+template<typename T>
+LEPONG_NODISCARD T GetCell(const ArchiveReader& reader, std::uint32_t match, Column column) noexcept
+{
+    const auto kColumn = GetColumn<T>(reader, match / skIndexBlockSize, column);
+    return kColumn && match < GetNumMatches(reader) ? kColumn[match % skIndexBlockSize] : T{};
+}
+
+///
+/// Loads the replay of the provided match, mapping its segment if needed.<br>
+/// If the match is not in the archive, the returned view is invalid.
+///
+LEPONG_NODISCARD ReplayView LoadReplay(ArchiveReader& reader, std::uint32_t match) noexcept;
+
+} // namespace lepong::Replay
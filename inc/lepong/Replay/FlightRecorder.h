@@ -0,0 +1,111 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "lepong/Attribute.h"
+#include "lepong/Game/State.h"
+#include "lepong/Replay/Replay.h"
+
+namespace lepong::FlightRecorder
+{
+
+// The flight recorder keeps the last moments of the match in fixed ring buffers and writes them to
+// skDumpPath when the game crashes.<br>
+// Recording is a few stores to pre-allocated memory, dumping only uses the OS file functions so it can run
+// from a crash handler even if the heap is corrupted.
+
+static constexpr const char* skDumpPath = "lepong.crash";
+
+static constexpr std::uint32_t skDumpMagic = 0x52464C4Cu; // "LLFR".
+static constexpr std::uint32_t skDumpVersion = 1u;
+
+// About a minute of play at 240 frames per second.
+static constexpr unsigned skMaxRecords = 1u << 15u;
+static constexpr unsigned skMaxFrameTimes = 1u << 14u;
+
+// A snapshot every skSnapshotPeriod ticks, so the oldest records can always be re-simulated from one.
+static constexpr unsigned skSnapshotPeriod = 256u;
+static constexpr unsigned skMaxSnapshots = skMaxRecords / skSnapshotPeriod + 2u;
+
+///
+/// A copy of the game state right after a tick.
+///
+struct Snapshot
+{
+    std::uint64_t tick = 0u;
+
+    // The number of records written before this snapshot since the match began.
+    std::uint64_t record = 0u;
+
+    State state;
+};
+
+///
+/// The start of a dump file.<br>
+/// The snapshots, records and frame times follow, in this order and from oldest to newest.
+///
+struct DumpHeader
+{
+    std::uint32_t magic = 0u;
+    std::uint32_t version = 0u;
+
+    std::uint32_t seed = 0u;
+
+    // The exception code or signal number that caused the dump.
+    std::uint32_t reason = 0u;
+
+    // The number of records written before the first dumped record since the match began.
+    std::uint64_t firstRecord = 0u;
+
+    std::uint32_t numSnapshots = 0u;
+    std::uint32_t numRecords = 0u;
+    std::uint32_t numFrameTimes = 0u;
+    std::uint32_t reserved = 0u;
+};
+
+static_assert(sizeof(DumpHeader) == 40);
+
+///
+/// Installs the crash handlers.<br>
+/// If the flight recorder is already initialized, this function returns false.
+///
+/// \return Whether the flight recorder was successfully initialized.
+///
+LEPONG_NODISCARD bool Init() noexcept;
+
+///
+/// Removes the crash handlers.
+///
+void Cleanup() noexcept;
+
+///
+/// Forgets everything recorded so far.
+///
+void BeginMatch(std::uint32_t seed) noexcept;
+
+///
+/// Records a key event.
+///
+void RecordKeyEvent(int key, bool pressed) noexcept;
+
+///
+/// Records a tick and the state it resulted in.
+///
+void RecordTick(float delta, std::uint64_t stateHash, const State& state) noexcept;
+
+///
+/// Records a frame's duration in nanoseconds.
+///
+void RecordFrameTime(std::uint64_t nanoseconds) noexcept;
+
+///
+/// Writes everything recorded to the dump file.<br>
+/// This is called by the crash handlers and only dumps once.
+///
+void Dump(std::uint32_t reason) noexcept;
+
+} // namespace lepong::FlightRecorder
@@ -0,0 +1,91 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "lepong/Attribute.h"
+#include "lepong/Window.h"
+
+namespace lepong::InputScript
+{
+
+// Drives the game without a player: key events are read from a timeline file and fed to the game through the same
+// callback as the window's, so they are recorded and replayed like real ones.<br>
+// Each line of the file is an event, blank lines and lines starting with '#' are ignored:<br>
+// - <code>seed 1234</code>: Seeds the match instead of the current time.<br>
+// - <code>120 UP down</code>: Presses a key before the tick 120, the first tick being 0.<br>
+// - <code>2.5s UP up</code>: Releases a key before the first tick that ends at or after 2.5 seconds of game time.<br>
+// - <code>600 quit</code>: Stops the game.<br>
+// Keys are names (SPACE, UP, DOWN, LEFT, RIGHT, ESCAPE, RETURN, SHIFT, CONTROL), single letters or digits, or virtual
+// key codes such as 0x26.<br>
+// Ticks and times can be mixed, but down the file the ticks must not decrease and neither must the times: a script
+// with a line due before one above it of the same kind is rejected, and the line is logged. The events due before
+// the same tick are fed in the order of the file.
+
+///
+/// Set this environment variable to the path of a script to run it.
+///
+static constexpr const char* skSelectionVariable = "LEPONG_INPUT_SCRIPT";
+
+///
+/// Set this environment variable to "fast" to run the script as fast as possible instead of in real time.
+///
+static constexpr const char* skModeVariable = "LEPONG_INPUT_SCRIPT_MODE";
+
+// The time step of every tick when running as fast as possible, whatever the time the frames take.
+static constexpr float skFastDelta = 1.0f / 60.0f;
+
+static constexpr unsigned skMaxEvents = 1u << 16u;
+
+enum class Mode
+{
+    // Ticks last as long as the frames, the script follows the clock.
+    RealTime,
+
+    // Ticks have a fixed time step, a script always produces the same match.
+    Fast
+};
+
+///
+/// \return Whether a script was selected with the environment variable.
+///
+LEPONG_NODISCARD bool IsSelected() noexcept;
+
+///
+/// Loads the selected script. Every malformed line is logged.<br>
+/// If a script is already loaded, this function returns false.
+///
+/// \return Whether the script was successfully loaded.
+///
+LEPONG_NODISCARD bool Load() noexcept;
+
+///
+/// Logs how many events were fed and unloads the script.<br>
+/// If no script is loaded, this function does nothing.
+///
+void Cleanup() noexcept;
+
+///
+/// \return How the loaded script is run, real time if no script is loaded.
+///
+LEPONG_NODISCARD Mode GetMode() noexcept;
+
+///
+/// \return The seed set by the loaded script, the provided one if it doesn't set one.
+///
+LEPONG_NODISCARD std::uint32_t GetSeed(std::uint32_t fallback) noexcept;
+
+///
+/// Feeds the events due before the next tick to the provided callback, must be called once per tick.<br>
+/// If no script is loaded, this function does nothing.
+///
+/// \param delta The time step of the next tick in seconds.
+///
+/// \return Whether the script didn't stop the game.
+///
+LEPONG_NODISCARD bool Feed(float delta, Window::PFNKeyCallback callback) noexcept;
+
+} // namespace lepong::InputScript
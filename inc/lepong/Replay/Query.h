@@ -0,0 +1,94 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "lepong/Game/Ball.h"
+
+#include "Archive.h"
+
+namespace lepong::Replay
+{
+
+enum class Comparison
+{
+    Less,
+    LessEqual,
+    Equal,
+    NotEqual,
+    GreaterEqual,
+    Greater
+};
+
+///
+/// A filter on an index column.<br>
+/// The value is converted to the column's type before comparing.
+///
+struct ColumnPredicate
+{
+    Column column = Column::Seed;
+    Comparison comparison = Comparison::Equal;
+    double value = 0.0;
+};
+
+///
+/// Describes the rallies a query looks for.<br>
+/// Rallies are not stored in the index so finding them requires re-simulating the candidate matches.
+///
+struct RallyPredicate
+{
+    // Rallies with fewer paddle hits are ignored.
+    std::uint32_t minPaddleHits = 0u;
+
+    // Only rallies lost by this side are reported, <code>Side::None</code> accepts both sides.
+    Side lostSide = Side::None;
+};
+
+struct Query
+{
+    std::vector<ColumnPredicate> columnPredicates;
+
+    bool findRallies = false;
+    RallyPredicate rallyPredicate;
+};
+
+struct RallyResult
+{
+    std::uint32_t match = 0u;
+    std::uint32_t rally = 0u;
+    std::uint32_t numPaddleHits = 0u;
+    Side lostSide = Side::None;
+};
+
+struct QueryResult
+{
+    ///
+    /// The matches that passed the column predicates, in archive order.<br>
+    /// When looking for rallies, these are the matches that were re-simulated.
+    ///
+    std::vector<std::uint32_t> matches;
+
+    ///
+    /// The rallies that passed the rally predicate, sorted by match then rally.
+    ///
+    std::vector<RallyResult> rallies;
+
+    ///
+    /// The number of re-simulated matches that did not reproduce their recorded state hashes.<br>
+    /// Rallies found after the first diverging tick of a match are not reported.
+    ///
+    std::uint32_t numDesyncedMatches = 0u;
+};
+
+///
+/// Runs the provided query on the archive.<br>
+/// Column predicates are evaluated on the index columns a block at a time. If the query looks for rallies,
+/// the matching replays are then re-simulated on all available cores.
+///
+LEPONG_NODISCARD QueryResult RunQuery(ArchiveReader& reader, const Query& query) noexcept;
+
+} // namespace lepong::Replay
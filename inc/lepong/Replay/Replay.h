@@ -0,0 +1,111 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "lepong/Attribute.h"
+
+namespace lepong::Replay
+{
+
+enum class RecordType : std::uint32_t
+{
+    Tick     = 0,
+    KeyEvent = 1
+};
+
+///
+/// A single replay record.<br>
+/// Key events apply to the first tick recorded after them.
+///
+struct Record
+{
+    RecordType type = RecordType::Tick;
+
+    // Tick.
+    float delta = 0.0f;
+
+    // Key event.
+    std::int32_t key = 0;
+    std::uint32_t pressed = 0u;
+
+    // Tick, the hash of the state after the tick.
+    std::uint64_t stateHash = 0u;
+};
+
+static_assert(sizeof(Record) == 24);
+
+///
+/// The start of every replay blob. The records follow right after it.
+///
+struct BlobHeader
+{
+    std::uint32_t magic = 0u;
+    std::uint32_t seed = 0u;
+};
+
+static constexpr std::uint32_t skBlobMagic = 0x50524C4Cu; // "LLRP".
+
+///
+/// Records are kept in memory until <code>WritePending</code>, a frame has a tick and a few key events.<br>
+/// If this many records are pending, they are written right away so that none is lost.
+///
+static constexpr std::uint32_t skMaxPendingRecords = 256u;
+
+///
+/// What the game knows about a match when it is over.
+///
+struct MatchSummary
+{
+    std::uint32_t playerScores[2] = { 0u, 0u };
+    std::uint32_t numRallies = 0u;
+    std::uint32_t numPaddleHits = 0u;
+};
+
+///
+/// Opens the replay archive for appending, creating it if needed.<br>
+/// If the replay system is already initialized, this function returns false.
+///
+/// \return Whether the replay system was successfully initialized.
+///
+LEPONG_NODISCARD bool Init() noexcept;
+
+///
+/// Closes the replay archive. A match that is still being recorded is discarded.
+///
+void Cleanup() noexcept;
+
+///
+/// Starts recording a new match.<br>
+/// If the replay system is not initialized or a match is already being recorded, this function does nothing.
+///
+/// \param seed The seed the random number generator was initialized with.
+///
+void BeginMatch(std::uint32_t seed) noexcept;
+
+///
+/// Records a key event. If no match is being recorded, this function does nothing.
+///
+void RecordKeyEvent(int key, bool pressed) noexcept;
+
+///
+/// Records a game update. If no match is being recorded, this function does nothing.
+///
+void RecordTick(float delta, std::uint64_t stateHash) noexcept;
+
+///
+/// Appends the pending records to the archive.<br>
+/// Meant to be called once per frame, outside of the updates.
+///
+void WritePending() noexcept;
+
+///
+/// Finishes the match being recorded and adds it to the archive index.<br>
+/// If no match is being recorded, this function does nothing.
+///
+void FinishMatch(const MatchSummary& summary) noexcept;
+
+} // namespace lepong::Replay
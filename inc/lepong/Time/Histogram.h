@@ -0,0 +1,65 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "lepong/Attribute.h"
+
+namespace lepong::Time
+{
+
+// Values are bucketed log-linearly: every power of two range is split into 2^skHistogramSubBucketBits buckets,
+// so any recorded value is known within 1 / 2^skHistogramSubBucketBits of its magnitude (about 1.6%).
+
+static constexpr unsigned skHistogramSubBucketBits = 6u;
+static constexpr unsigned skHistogramMaxValueBits = 40u; // About 18 minutes in nanoseconds.
+
+static constexpr unsigned skNumHistogramBuckets =
+    (skHistogramMaxValueBits - skHistogramSubBucketBits + 1u) << skHistogramSubBucketBits;
+
+///
+/// A latency histogram.<br>
+/// Values can be recorded from any thread without locking, recording is a handful of relaxed atomic adds.
+///
+struct Histogram
+{
+    std::atomic<std::uint64_t> counts[skNumHistogramBuckets] = {};
+
+    std::atomic<std::uint64_t> totalCount = 0u;
+    std::atomic<std::uint64_t> sum = 0u;
+    std::atomic<std::uint64_t> min = UINT64_MAX;
+    std::atomic<std::uint64_t> max = 0u;
+};
+
+///
+/// Records a value. Values too big to be tracked are clamped.
+///
+void RecordValue(Histogram& histogram, std::uint64_t value) noexcept;
+
+///
+/// Adds the values of <i>from</i> to <i>into</i>.
+///
+void MergeHistogram(Histogram& into, const Histogram& from) noexcept;
+
+///
+/// Removes all the values from the provided histogram.
+///
+void ResetHistogram(Histogram& histogram) noexcept;
+
+///
+/// \param percentile The percentile, between 0 and 100.
+/// \return The smallest value that is greater or equal to the provided percentage of the recorded values.<br>
+/// If the histogram is empty, this function returns 0.
+///
+LEPONG_NODISCARD std::uint64_t GetValueAtPercentile(const Histogram& histogram, double percentile) noexcept;
+
+///
+/// \return The mean of the recorded values or 0 if the histogram is empty.
+///
+LEPONG_NODISCARD double GetMean(const Histogram& histogram) noexcept;
+
+} // namespace lepong::Time
@@ -0,0 +1,70 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "lepong/Attribute.h"
+
+#include "Histogram.h"
+
+namespace lepong::Profiler
+{
+
+enum class Timer : unsigned
+{
+    Frame,
+    Update,
+
+    // The ticks simulated ahead, see "lepong/Game/RunAhead.h".
+    RunAhead,
+
+    Render,
+    Swap,
+
+    // Measured on the GPU, see "lepong/Graphics/GpuTimer.h".
+    GpuFrame,
+    GpuClear,
+    GpuPost,
+    GpuBall,
+    GpuPaddles,
+    GpuScene,
+    GpuUpscale,
+    GpuSwap,
+    Count
+};
+
+///
+/// Opens the stats file.<br>
+/// If the profiler is already initialized, this function returns false.
+///
+/// \return Whether the profiler was successfully initialized.
+///
+LEPONG_NODISCARD bool Init() noexcept;
+
+///
+/// Dumps the pending measurements and closes the stats file.
+///
+void Cleanup() noexcept;
+
+///
+/// Records a measurement in nanoseconds. This can be called from any thread.
+///
+void Record(Timer timer, std::uint64_t nanoseconds) noexcept;
+
+///
+/// Records the time since the previous frame and dumps the histograms once per dump period.<br>
+/// Must be called once at the end of every frame.
+///
+/// \return The time since the previous frame in nanoseconds.
+///
+std::uint64_t OnFrameEnd() noexcept;
+
+///
+/// \return The histogram of the provided timer's measurements since the last dump.
+///
+LEPONG_NODISCARD const Time::Histogram& GetHistogram(Timer timer) noexcept;
+
+} // namespace lepong::Profiler
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "lepong/Attribute.h"
 
 namespace lepong::Time
@@ -26,4 +28,9 @@ void Cleanup() noexcept;
 ///
 LEPONG_NODISCARD float Get() noexcept;
 
+///
+/// Same as above but in nanoseconds, which doesn't lose precision as the game keeps running.
+///
+LEPONG_NODISCARD std::uint64_t GetNanoseconds() noexcept;
+
 } // namespace lepong::Time
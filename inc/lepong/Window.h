@@ -20,7 +20,12 @@ namespace lepong::Window
 using PFNKeyCallback = void (*)(int key, bool pressed);
 
 ///
-/// Initializes the window system.<br>
+/// A resize callback, the size is the new size of the window's client area in pixels.<br>
+///
+using PFNResizeCallback = void (*)(const Vector2i& size);
+
+///
+/// Initializes the window system and makes the process DPI aware, windows are then sized in physical pixels.<br>
 /// If the window system is already initialized, this function returns false.
 ///
 /// \param callback The function called to process window events.
@@ -36,6 +41,14 @@ LEPONG_NODISCARD bool Init() noexcept;
 ///
 void SetKeyCallback(PFNKeyCallback callback) noexcept;
 
+///
+/// Sets the function to be called when the window's client area is resized, minimizing the window is ignored.<br>
+/// Calling this function with nullptr disables the resize callback.
+///
+/// \param callback The new resize callback.
+///
+void SetResizeCallback(PFNResizeCallback callback) noexcept;
+
 ///
 /// Cleans up all resources used by the window system.<br>
 /// If the window system is not initialized, this function does nothing.
@@ -44,12 +57,18 @@ void Cleanup() noexcept;
 
 ///
 /// Creates a window with the provided size and title.<br>
+/// The size is in pixels at 96 DPI, it is scaled to the screen's DPI.<br>
 /// Not storing the returned window handle results in a memory leak.
 ///
 /// \return The newly created window or <code>nullptr</code> if the window system is not initialized.
 ///
 LEPONG_NODISCARD HWND MakeWindow(const Vector2i& size, const wchar_t* title) noexcept;
 
+///
+/// \return The size of the provided window's client area in pixels.
+///
+LEPONG_NODISCARD Vector2i GetClientSize(HWND window) noexcept;
+
 ///
 /// Destroys the provided window.
 ///
@@ -0,0 +1,599 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#define LEPONG_BATCH_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "lepong/Check.h"
+
+#include "lepong/Game/Match.h"
+
+#include "lepong/Batch/Batch.h"
+
+#include "Pages.h"
+
+namespace lepong::Batch
+{
+
+// The batch uses the same constants as Match.
+static constexpr auto skTerrainWidth = static_cast<float>(Match::skTerrainSize.x);
+static constexpr auto skTerrainHeight = static_cast<float>(Match::skTerrainSize.y);
+
+static constexpr auto skBallRadius = Match::skBallRadius;
+static constexpr auto skPaddleHalfWidth = Match::skPaddleSize.x / 2.0f;
+static constexpr auto skPaddleHalfHeight = Match::skPaddleSize.y / 2.0f;
+
+// See Paddle::CollideWithTerrain and Ball::DoCollideWith.
+static constexpr auto skPaddleMinTerrainOffset = Match::skPaddleSize.y * 0.1f;
+static constexpr auto skPaddleGraceZone = Match::skPaddleSize.y * 0.1f;
+
+static_assert(skPaddle2PositionX == skTerrainWidth - skPaddle1PositionX);
+
+// A ball touching a paddle is never past a side, so points are scored without looking at the paddle collisions.
+static_assert(skPaddle1PositionX + skPaddleHalfWidth - skBallRadius > skBallRadius);
+
+static constexpr auto skNumFloatArrays = 9u;
+static constexpr auto skNumIntegerArrays = 4u;
+
+// A policy does not move while the ball is this close to the paddle's center.
+static constexpr auto skTrackingDeadZone = 10.0f;
+
+// Every allocation starts with a header, so that it is freed the way it was allocated.
+struct alignas(skArrayAlignment) ArrayHeader
+{
+    std::size_t size = 0u;
+    Pages pages = Pages::Normal;
+};
+
+static constexpr auto skNumPages = static_cast<unsigned>(Pages::Count);
+
+static std::atomic<Pages> sPages = Pages::Normal;
+static std::atomic<std::uint64_t> sNumBytes[skNumPages] = {};
+
+static std::atomic<bool> sVectorized = true;
+
+void* AllocateArrays(std::size_t size) noexcept
+{
+    const auto kSize = size + sizeof(ArrayHeader);
+
+    auto pages = (kSize >= skMinPagedSize) ? sPages.load(std::memory_order_relaxed) : Pages::Normal;
+    void* memory = nullptr;
+
+    while (pages != Pages::Normal)
+    {
+        memory = AllocatePages(kSize, pages);
+
+        if (memory)
+        {
+            break;
+        }
+
+        pages = static_cast<Pages>(static_cast<unsigned>(pages) - 1u);
+    }
+
+    if (!memory)
+    {
+        memory = ::operator new(kSize, std::align_val_t{ skArrayAlignment }, std::nothrow);
+        LEPONG_CHECK_OR_RETURN_VAL(memory, nullptr);
+    }
+
+    const auto kHeader = new (memory) ArrayHeader;
+    kHeader->size = kSize;
+    kHeader->pages = pages;
+
+    sNumBytes[static_cast<unsigned>(pages)].fetch_add(kSize, std::memory_order_relaxed);
+
+    return kHeader + 1;
+}
+
+void FreeArrays(void* memory) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(memory);
+
+    const auto kHeader = static_cast<ArrayHeader*>(memory) - 1;
+    const auto kSize = kHeader->size;
+    const auto kPages = kHeader->pages;
+
+    sNumBytes[static_cast<unsigned>(kPages)].fetch_sub(kSize, std::memory_order_relaxed);
+
+    if (kPages == Pages::Normal)
+    {
+        ::operator delete(kHeader, std::align_val_t{ skArrayAlignment });
+    }
+    else
+    {
+        FreePages(kHeader, kSize, kPages);
+    }
+}
+
+void SetArrayPages(Pages pages) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(pages < Pages::Count);
+
+    sPages.store(pages, std::memory_order_relaxed);
+}
+
+std::uint64_t GetArrayBytes(Pages pages) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(pages < Pages::Count, 0u);
+
+    return sNumBytes[static_cast<unsigned>(pages)].load(std::memory_order_relaxed);
+}
+
+void SetVectorized(bool vectorized) noexcept
+{
+    sVectorized.store(vectorized, std::memory_order_relaxed);
+}
+
+///
+/// Puts the ball and paddles of a match back in the middle of the terrain, ready to be served.
+///
+static void ResetMatch(Batch& batch, unsigned match) noexcept;
+
+///
+/// Same as Xorshift32 in Math.cpp, with one state per match.
+///
+LEPONG_NODISCARD static float NextRandomSign(std::uint32_t& state) noexcept;
+
+Batch MakeBatch(unsigned numMatches, std::uint32_t seed) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(numMatches, Batch{});
+
+    // Each array starts one cache line further than a power of two away from the previous one: on huge pages, arrays
+    // a power of two apart would all map to the same cache sets and evict each other.
+    const auto kArrayStride = GetArraySize(numMatches) + skArrayAlignment / sizeof(float);
+    const auto kMemorySize = kArrayStride * (skNumFloatArrays + skNumIntegerArrays) * sizeof(float);
+
+    Batch batch;
+    batch.memory = AllocateArrays(kMemorySize);
+
+    LEPONG_CHECK_OR_RETURN_VAL(batch.memory, Batch{});
+    std::memset(batch.memory, 0, kMemorySize);
+
+    batch.numMatches = numMatches;
+
+    auto floats = static_cast<float*>(batch.memory);
+
+    for (auto array : {
+        &batch.ballPositionsX, &batch.ballPositionsY, &batch.ballDirectionsX, &batch.ballDirectionsY, &batch.ballSpeeds,
+        &batch.paddle1PositionsY, &batch.paddle1Directions, &batch.paddle2PositionsY, &batch.paddle2Directions })
+    {
+        *array = floats;
+        floats += kArrayStride;
+    }
+
+    auto integers = reinterpret_cast<std::uint32_t*>(floats);
+
+    for (auto array : { &batch.player1Scores, &batch.player2Scores, &batch.playing, &batch.randomStates })
+    {
+        *array = integers;
+        integers += kArrayStride;
+    }
+
+    for (auto i = 0u; i < numMatches; ++i)
+    {
+        // Spread the seeds so that neighbouring matches don't play out the same way, 0 is not a valid state.
+        const auto kState = (seed + i) * 0x9E3779B9u;
+        batch.randomStates[i] = kState ? kState : 1u;
+
+        ResetMatch(batch, i);
+    }
+
+    return batch;
+}
+
+void ResetMatch(Batch& batch, unsigned match) noexcept
+{
+    batch.ballPositionsX[match] = skTerrainWidth / 2.0f;
+    batch.ballPositionsY[match] = skTerrainHeight / 2.0f;
+    batch.ballDirectionsX[match] = 0.0f;
+    batch.ballDirectionsY[match] = 0.0f;
+    batch.ballSpeeds[match] = 0.0f;
+
+    batch.paddle1PositionsY[match] = skTerrainHeight / 2.0f;
+    batch.paddle1Directions[match] = 0.0f;
+    batch.paddle2PositionsY[match] = skTerrainHeight / 2.0f;
+    batch.paddle2Directions[match] = 0.0f;
+
+    batch.playing[match] = 0u;
+}
+
+float NextRandomSign(std::uint32_t& state) noexcept
+{
+    state ^= state << 13u;
+    state ^= state >> 17u;
+    state ^= state << 5u;
+
+    return (state & 0x80000000u) ? 1.0f : -1.0f;
+}
+
+void DestroyBatch(Batch& batch) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(batch.IsValid());
+
+    FreeArrays(batch.memory);
+    batch = Batch{};
+}
+
+///
+/// Serves the balls of the matches that are not playing, see Match::LaunchBall.
+///
+static void ServeBalls(Batch& batch) noexcept;
+
+///
+/// Moves the paddles, see Paddle::Update.
+///
+static void MovePaddles(float* positionsY, float* directions, const Action* actions, unsigned numMatches) noexcept;
+
+///
+/// Moves the balls and bounces them off the top and bottom of the terrain, see Ball::CollideWithTerrain.
+///
+static void MoveBalls(Batch& batch) noexcept;
+
+///
+/// Bounces the ball of the provided match off a paddle if they collide, see Ball::CollideWith.
+///
+static void CollideBallWithPaddle(
+    Batch& batch, unsigned match, float paddlePositionX, float paddlePositionY, float paddleForward) noexcept;
+
+///
+/// Gives a point to the player opposite to the side the ball touched and resets the matches that scored, see
+/// Match::CheckBallSideCollision.<br>
+/// Resets are masked instead of branched on, a tick costs the same whatever the number of matches that score.
+///
+/// \param rewards Player 1's rewards, can be nullptr.
+///
+static void ScorePoints(Batch& batch, float* rewards) noexcept;
+
+///
+/// Same as ScorePoints for the matches from <i>first</i> to the end of the batch, one at a time.
+///
+static void ScorePoints(Batch& batch, unsigned first, float* rewards) noexcept;
+
+///
+/// Advances every match by skTickDelta, accumulating player 1's rewards if they are not nullptr.
+///
+static void Tick(Batch& batch, const Action* player1Actions, const Action* player2Actions, float* rewards) noexcept;
+
+void Step(Batch& batch, const Action* player1Actions, const Action* player2Actions) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(batch.IsValid());
+
+    Tick(batch, player1Actions, player2Actions, nullptr);
+}
+
+void StepRepeated(
+    Batch& batch, const Action* player1Actions, const Action* player2Actions, unsigned numTicks,
+    float* rewards, float* observations) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(batch.IsValid() && numTicks);
+
+    if (rewards)
+    {
+        std::fill(rewards, rewards + batch.numMatches, 0.0f);
+    }
+
+    // The actions are applied on every tick: a point resets the paddles, they must move again right after.
+    for (auto i = 0u; i < numTicks; ++i)
+    {
+        Tick(batch, player1Actions, player2Actions, rewards);
+    }
+
+    if (observations)
+    {
+        Observe(batch, observations);
+    }
+}
+
+void Observe(const Batch& batch, float* observations) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(batch.IsValid());
+
+    for (auto i = 0u; i < batch.numMatches; ++i)
+    {
+        auto observation = observations + static_cast<std::size_t>(i) * skObservationSize;
+
+        observation[static_cast<unsigned>(Observation::BallPositionX)] = batch.ballPositionsX[i];
+        observation[static_cast<unsigned>(Observation::BallPositionY)] = batch.ballPositionsY[i];
+        observation[static_cast<unsigned>(Observation::BallDirectionX)] = batch.ballDirectionsX[i];
+        observation[static_cast<unsigned>(Observation::BallDirectionY)] = batch.ballDirectionsY[i];
+        observation[static_cast<unsigned>(Observation::BallSpeed)] = batch.ballSpeeds[i];
+        observation[static_cast<unsigned>(Observation::Paddle1PositionY)] = batch.paddle1PositionsY[i];
+        observation[static_cast<unsigned>(Observation::Paddle2PositionY)] = batch.paddle2PositionsY[i];
+        observation[static_cast<unsigned>(Observation::Playing)] = static_cast<float>(batch.playing[i]);
+    }
+}
+
+void Tick(Batch& batch, const Action* player1Actions, const Action* player2Actions, float* rewards) noexcept
+{
+    ServeBalls(batch);
+
+    MoveBalls(batch);
+    MovePaddles(batch.paddle1PositionsY, batch.paddle1Directions, player1Actions, batch.numMatches);
+    MovePaddles(batch.paddle2PositionsY, batch.paddle2Directions, player2Actions, batch.numMatches);
+
+    for (auto i = 0u; i < batch.numMatches; ++i)
+    {
+        const auto kCollidesTop = (batch.ballPositionsY[i] > skTerrainHeight - skBallRadius) && (batch.ballDirectionsY[i] > 0.0f);
+        const auto kCollidesBottom = (batch.ballPositionsY[i] < skBallRadius) && (batch.ballDirectionsY[i] < 0.0f);
+
+        if (kCollidesTop || kCollidesBottom)
+        {
+            batch.ballDirectionsY[i] = -batch.ballDirectionsY[i];
+        }
+    }
+
+    for (auto i = 0u; i < batch.numMatches; ++i)
+    {
+        CollideBallWithPaddle(batch, i, skPaddle1PositionX, batch.paddle1PositionsY[i],  1.0f);
+        CollideBallWithPaddle(batch, i, skPaddle2PositionX, batch.paddle2PositionsY[i], -1.0f);
+    }
+
+    ScorePoints(batch, rewards);
+
+    ++batch.numSteps;
+}
+
+void ServeBalls(Batch& batch) noexcept
+{
+    // Every match draws a direction, only the ones that are not playing keep it.
+    for (auto i = 0u; i < batch.numMatches; ++i)
+    {
+        const auto kServe = !batch.playing[i];
+        auto state = batch.randomStates[i];
+
+        const auto kDirectionX = NextRandomSign(state);
+        const auto kDirectionY = NextRandomSign(state);
+        const auto kMag = sqrtf(kDirectionX * kDirectionX + kDirectionY * kDirectionY);
+
+        batch.randomStates[i] = kServe ? state : batch.randomStates[i];
+        batch.ballDirectionsX[i] = kServe ? kDirectionX / kMag : batch.ballDirectionsX[i];
+        batch.ballDirectionsY[i] = kServe ? kDirectionY / kMag : batch.ballDirectionsY[i];
+        batch.ballSpeeds[i] = kServe ? Ball::skDefaultMoveSpeed : batch.ballSpeeds[i];
+        batch.playing[i] = 1u;
+    }
+}
+
+void MovePaddles(float* positionsY, float* directions, const Action* actions, unsigned numMatches) noexcept
+{
+    if (actions)
+    {
+        for (auto i = 0u; i < numMatches; ++i)
+        {
+            // Same as the paddle's move functions when a key is held.
+            directions[i] = (actions[i] == Action::Up) ? 1.0f : (actions[i] == Action::Down) ? -1.0f : 0.0f;
+        }
+    }
+
+    constexpr auto kTop = skTerrainHeight - skPaddleHalfHeight;
+    constexpr auto kBottom = skPaddleHalfHeight;
+
+    for (auto i = 0u; i < numMatches; ++i)
+    {
+        const auto kPositionY = positionsY[i] + (directions[i] * Paddle::skDefaultMoveSpeed) * skTickDelta;
+
+        const auto kCollidesTop = (kPositionY + skPaddleMinTerrainOffset) > kTop;
+        const auto kCollidesBottom = (kPositionY - skPaddleMinTerrainOffset) < kBottom;
+
+        // Colliding paddles stay where they were.
+        positionsY[i] = (kCollidesTop || kCollidesBottom) ? positionsY[i] : kPositionY;
+    }
+}
+
+void MoveBalls(Batch& batch) noexcept
+{
+    for (auto i = 0u; i < batch.numMatches; ++i)
+    {
+        const auto kSpeed = batch.ballSpeeds[i];
+
+        batch.ballPositionsX[i] += (batch.ballDirectionsX[i] * kSpeed) * skTickDelta;
+        batch.ballPositionsY[i] += (batch.ballDirectionsY[i] * kSpeed) * skTickDelta;
+    }
+}
+
+void CollideBallWithPaddle(
+    Batch& batch, unsigned match, float paddlePositionX, float paddlePositionY, float paddleForward) noexcept
+{
+    const auto kBallPositionX = batch.ballPositionsX[match];
+    const auto kBallPositionY = batch.ballPositionsY[match];
+
+    const auto kMovingToward = (batch.ballDirectionsX[match] * paddleForward) < 0.0f;
+
+    if (!kMovingToward)
+    {
+        return;
+    }
+
+    const auto kOuterEdge = kBallPositionX + (skBallRadius * 0.25f) * -paddleForward;
+    const auto kPaddleFrontEdge = paddlePositionX + skPaddleHalfWidth * paddleForward;
+
+    const auto kBehind = (paddleForward > 0.0f) ? (kOuterEdge < kPaddleFrontEdge) : (kOuterEdge > kPaddleFrontEdge);
+
+    if (kBehind)
+    {
+        return;
+    }
+
+    const auto kInRangeY =
+        kBallPositionY < (paddlePositionY + skPaddleHalfHeight + skPaddleGraceZone) &&
+        kBallPositionY > (paddlePositionY - skPaddleHalfHeight - skPaddleGraceZone);
+
+    // The ball is projected on the paddle's front edge so only the horizontal distance counts.
+    const auto kDistanceX = kBallPositionX - kPaddleFrontEdge;
+
+    if (!kInRangeY || (kDistanceX * kDistanceX) >= (skBallRadius * skBallRadius))
+    {
+        return;
+    }
+
+    const auto kToBallX = kBallPositionX - paddlePositionX;
+    const auto kToBallY = kBallPositionY - paddlePositionY;
+    const auto kMag = sqrtf(kToBallX * kToBallX + kToBallY * kToBallY);
+
+    batch.ballSpeeds[match] += 50.0f;
+    batch.ballDirectionsX[match] = kToBallX / kMag;
+    batch.ballDirectionsY[match] = kToBallY / kMag;
+}
+
+#if defined(LEPONG_BATCH_SSE2)
+
+///
+/// \return The lanes of <i>value</i> where <i>mask</i> is set, the lanes of <i>current</i> elsewhere.
+///
+LEPONG_NODISCARD static __m128 Select(__m128 mask, __m128 value, __m128 current) noexcept
+{
+    return _mm_or_ps(_mm_and_ps(mask, value), _mm_andnot_ps(mask, current));
+}
+
+#endif
+
+void ScorePoints(Batch& batch, float* rewards) noexcept
+{
+    auto first = 0u;
+
+#if defined(LEPONG_BATCH_SSE2)
+    // The scalar code then scores every match.
+    const auto kNumVectorized = sVectorized.load(std::memory_order_relaxed) ? batch.numMatches / 4u * 4u : 0u;
+
+    const auto kLeft = _mm_set1_ps(skBallRadius);
+    const auto kRight = _mm_set1_ps(skTerrainWidth - skBallRadius);
+    const auto kCenterX = _mm_set1_ps(skTerrainWidth / 2.0f);
+    const auto kCenterY = _mm_set1_ps(skTerrainHeight / 2.0f);
+
+    // Scores are small, the signed comparison is fine.
+    const auto kMaxScore = _mm_set1_epi32(static_cast<int>(skWinningScore) - 1);
+
+    auto numFinishedMatches = _mm_setzero_si128();
+
+    // The arrays are aligned, 4 matches at a time.
+    for (; first < kNumVectorized; first += 4u)
+    {
+        const auto kPositionX = _mm_load_ps(batch.ballPositionsX + first);
+
+        // Lanes are all ones where the mask is set, so subtracting a mask counts 1 per lane.
+        const auto kLostMask = _mm_cmplt_ps(kPositionX, kLeft);
+        const auto kWonMask = _mm_cmpgt_ps(kPositionX, kRight);
+        const auto kScoredMask = _mm_or_ps(kLostMask, kWonMask);
+
+        const auto kLost = _mm_castps_si128(kLostMask);
+        const auto kWon = _mm_castps_si128(kWonMask);
+
+        const auto kPlayer1Scores = reinterpret_cast<__m128i*>(batch.player1Scores + first);
+        const auto kPlayer2Scores = reinterpret_cast<__m128i*>(batch.player2Scores + first);
+
+        const auto kPlayer1Score = _mm_sub_epi32(_mm_load_si128(kPlayer1Scores), kWon);
+        const auto kPlayer2Score = _mm_sub_epi32(_mm_load_si128(kPlayer2Scores), kLost);
+
+        const auto kFinished = _mm_or_si128(
+            _mm_cmpgt_epi32(kPlayer1Score, kMaxScore), _mm_cmpgt_epi32(kPlayer2Score, kMaxScore));
+
+        _mm_store_si128(kPlayer1Scores, _mm_andnot_si128(kFinished, kPlayer1Score));
+        _mm_store_si128(kPlayer2Scores, _mm_andnot_si128(kFinished, kPlayer2Score));
+        numFinishedMatches = _mm_sub_epi32(numFinishedMatches, kFinished);
+
+        if (rewards)
+        {
+            const auto kReward = _mm_cvtepi32_ps(_mm_sub_epi32(kLost, kWon));
+            _mm_storeu_ps(rewards + first, _mm_add_ps(_mm_loadu_ps(rewards + first), kReward));
+        }
+
+        const auto ResetTo = [kScoredMask](float* array, __m128 value) noexcept
+        {
+            _mm_store_ps(array, Select(kScoredMask, value, _mm_load_ps(array)));
+        };
+
+        const auto kZero = _mm_setzero_ps();
+
+        ResetTo(batch.ballPositionsX + first, kCenterX);
+        ResetTo(batch.ballPositionsY + first, kCenterY);
+        ResetTo(batch.ballDirectionsX + first, kZero);
+        ResetTo(batch.ballDirectionsY + first, kZero);
+        ResetTo(batch.ballSpeeds + first, kZero);
+
+        ResetTo(batch.paddle1PositionsY + first, kCenterY);
+        ResetTo(batch.paddle1Directions + first, kZero);
+        ResetTo(batch.paddle2PositionsY + first, kCenterY);
+        ResetTo(batch.paddle2Directions + first, kZero);
+
+        const auto kPlaying = reinterpret_cast<__m128i*>(batch.playing + first);
+        _mm_store_si128(kPlaying, _mm_andnot_si128(_mm_castps_si128(kScoredMask), _mm_load_si128(kPlaying)));
+    }
+
+    alignas(16) std::uint32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), numFinishedMatches);
+
+    batch.numFinishedMatches += static_cast<std::uint64_t>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+#endif
+
+    ScorePoints(batch, first, rewards);
+}
+
+void ScorePoints(Batch& batch, unsigned first, float* rewards) noexcept
+{
+    for (auto i = first; i < batch.numMatches; ++i)
+    {
+        const auto kBallPositionX = batch.ballPositionsX[i];
+
+        const std::uint32_t kLost = kBallPositionX < skBallRadius;
+        const std::uint32_t kWon = kBallPositionX > skTerrainWidth - skBallRadius;
+        const auto kScored = (kLost | kWon) != 0u;
+
+        const auto kPlayer1Score = batch.player1Scores[i] + kWon;
+        const auto kPlayer2Score = batch.player2Scores[i] + kLost;
+        const std::uint32_t kFinished = (kPlayer1Score >= skWinningScore) | (kPlayer2Score >= skWinningScore);
+
+        // Every bit set if the match goes on, 0 if it finished.
+        const auto kKeepScores = kFinished - 1u;
+
+        batch.player1Scores[i] = kPlayer1Score & kKeepScores;
+        batch.player2Scores[i] = kPlayer2Score & kKeepScores;
+        batch.numFinishedMatches += kFinished;
+
+        if (rewards)
+        {
+            rewards[i] += static_cast<float>(kWon) - static_cast<float>(kLost);
+        }
+
+        batch.ballPositionsX[i] = kScored ? skTerrainWidth / 2.0f : batch.ballPositionsX[i];
+        batch.ballPositionsY[i] = kScored ? skTerrainHeight / 2.0f : batch.ballPositionsY[i];
+        batch.ballDirectionsX[i] = kScored ? 0.0f : batch.ballDirectionsX[i];
+        batch.ballDirectionsY[i] = kScored ? 0.0f : batch.ballDirectionsY[i];
+        batch.ballSpeeds[i] = kScored ? 0.0f : batch.ballSpeeds[i];
+
+        batch.paddle1PositionsY[i] = kScored ? skTerrainHeight / 2.0f : batch.paddle1PositionsY[i];
+        batch.paddle1Directions[i] = kScored ? 0.0f : batch.paddle1Directions[i];
+        batch.paddle2PositionsY[i] = kScored ? skTerrainHeight / 2.0f : batch.paddle2PositionsY[i];
+        batch.paddle2Directions[i] = kScored ? 0.0f : batch.paddle2Directions[i];
+
+        batch.playing[i] = kScored ? 0u : batch.playing[i];
+    }
+}
+
+void ComputeTrackingActions(const Batch& batch, Action* player1Actions, Action* player2Actions) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(batch.IsValid());
+
+    const auto ComputeAction = [](float ballPositionY, float paddlePositionY) noexcept
+    {
+        const auto kOffset = ballPositionY - paddlePositionY;
+        return (kOffset > skTrackingDeadZone) ? Action::Up : (kOffset < -skTrackingDeadZone) ? Action::Down : Action::None;
+    };
+
+    for (auto i = 0u; i < batch.numMatches; ++i)
+    {
+        player1Actions[i] = ComputeAction(batch.ballPositionsY[i], batch.paddle1PositionsY[i]);
+        player2Actions[i] = ComputeAction(batch.ballPositionsY[i], batch.paddle2PositionsY[i]);
+    }
+}
+
+} // namespace lepong::Batch
@@ -0,0 +1,64 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <Windows.h>
+
+#include "lepong/Check.h"
+
+#include "Pages.h"
+
+namespace lepong::Batch
+{
+
+///
+/// Enables the lock pages privilege of the process, which large pages need.
+///
+/// \return Whether the account holds the privilege.
+///
+LEPONG_NODISCARD static bool EnableLockPagesPrivilege() noexcept;
+
+void* AllocatePages(std::size_t size, Pages pages) noexcept
+{
+    // Windows has no transparent huge pages.
+    LEPONG_CHECK_OR_RETURN_VAL(pages == Pages::Huge, nullptr);
+
+    static const auto skPrivileged = EnableLockPagesPrivilege();
+    const auto kLargePageSize = GetLargePageMinimum();
+
+    LEPONG_CHECK_OR_RETURN_VAL(skPrivileged && kLargePageSize, nullptr);
+
+    const auto kSize = (size + kLargePageSize - 1u) / kLargePageSize * kLargePageSize;
+
+    // Fails when the physical memory is too fragmented to find contiguous large pages.
+    return VirtualAlloc(nullptr, kSize, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+}
+
+bool EnableLockPagesPrivilege() noexcept
+{
+    HANDLE token = nullptr;
+    LEPONG_CHECK_OR_RETURN_VAL(OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token), false);
+
+    TOKEN_PRIVILEGES privileges = {};
+    privileges.PrivilegeCount = 1;
+    privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+
+    auto enabled = LookupPrivilegeValueW(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid) != FALSE;
+
+    // Succeeds even when the account doesn't hold the privilege, the last error tells.
+    enabled = enabled &&
+        AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr) &&
+        GetLastError() == ERROR_SUCCESS;
+
+    CloseHandle(token);
+    return enabled;
+}
+
+void FreePages(void* memory, std::size_t size, Pages pages) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(memory && pages == Pages::Huge);
+
+    VirtualFree(memory, 0, MEM_RELEASE);
+}
+
+} // namespace lepong::Batch
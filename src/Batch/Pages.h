@@ -0,0 +1,28 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+
+#include "lepong/Batch/Batch.h"
+
+namespace lepong::Batch
+{
+
+// The platform part of AllocateArrays, implemented once per platform.
+
+///
+/// Maps memory backed by the provided pages, which are not normal ones.
+///
+/// \return The memory, aligned to at least skArrayAlignment, or nullptr if those pages can't be had.
+///
+LEPONG_NODISCARD void* AllocatePages(std::size_t size, Pages pages) noexcept;
+
+///
+/// Unmaps memory returned by AllocatePages with the same size and pages.
+///
+void FreePages(void* memory, std::size_t size, Pages pages) noexcept;
+
+} // namespace lepong::Batch
@@ -0,0 +1,101 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cstdint>
+#include <sys/mman.h>
+
+#include "lepong/Check.h"
+
+#include "Pages.h"
+
+#if !defined(MAP_HUGE_SHIFT)
+#define MAP_HUGE_SHIFT 26
+#endif
+
+namespace lepong::Batch
+{
+
+// The size of the huge pages asked for, whatever the system's default.
+static constexpr std::size_t skHugePageSize = 2u << 20u;
+static constexpr int skHugePageFlag = 21 << MAP_HUGE_SHIFT;
+
+///
+/// \return The provided size rounded up to whole huge pages.
+///
+LEPONG_NODISCARD static constexpr std::size_t RoundToHugePages(std::size_t size) noexcept
+{
+    return (size + skHugePageSize - 1u) / skHugePageSize * skHugePageSize;
+}
+
+///
+/// Maps memory from the huge page pool.
+///
+LEPONG_NODISCARD static void* MapHugePages(std::size_t size) noexcept;
+
+///
+/// Maps memory aligned to a huge page and advises the kernel to back it with transparent huge pages.
+///
+LEPONG_NODISCARD static void* MapTransparentPages(std::size_t size) noexcept;
+
+void* AllocatePages(std::size_t size, Pages pages) noexcept
+{
+    switch (pages)
+    {
+    case Pages::Huge:
+        return MapHugePages(RoundToHugePages(size));
+    case Pages::Transparent:
+        return MapTransparentPages(RoundToHugePages(size));
+    default:
+        return nullptr;
+    }
+}
+
+void* MapHugePages(std::size_t size) noexcept
+{
+    // Fails right away when the pool doesn't have enough free pages, see /proc/sys/vm/nr_hugepages.
+    const auto kMemory = mmap(
+        nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | skHugePageFlag, -1, 0);
+
+    return kMemory != MAP_FAILED ? kMemory : nullptr;
+}
+
+void* MapTransparentPages(std::size_t size) noexcept
+{
+    // Only aligned huge pages can be merged, the mapping is trimmed to an aligned range.
+    const auto kMappedSize = size + skHugePageSize;
+    const auto kMapping = mmap(nullptr, kMappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    LEPONG_CHECK_OR_RETURN_VAL(kMapping != MAP_FAILED, nullptr);
+
+    const auto kStart = reinterpret_cast<std::uintptr_t>(kMapping);
+    const auto kAligned = (kStart + skHugePageSize - 1u) / skHugePageSize * skHugePageSize;
+    const auto kHead = kAligned - kStart;
+
+    if (kHead)
+    {
+        munmap(kMapping, kHead);
+    }
+
+    munmap(reinterpret_cast<void*>(kAligned + size), skHugePageSize - kHead);
+
+    const auto kMemory = reinterpret_cast<void*>(kAligned);
+
+    // Fails when transparent huge pages are disabled, the memory would then be no better than the heap's.
+    if (madvise(kMemory, size, MADV_HUGEPAGE) != 0)
+    {
+        munmap(kMemory, size);
+        return nullptr;
+    }
+
+    return kMemory;
+}
+
+void FreePages(void* memory, std::size_t size, Pages pages) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(memory && pages != Pages::Normal);
+
+    munmap(memory, RoundToHugePages(size));
+}
+
+} // namespace lepong::Batch
@@ -0,0 +1,210 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <chrono>
+#include <new>
+
+#include "lepong/Check.h"
+#include "lepong/Batch/Sharding.h"
+#include "lepong/Memory/FrameArena.h"
+
+namespace lepong::Batch
+{
+
+///
+/// Pins the calling thread, creates the shard and steps it until the batch is stopped.
+///
+static void RunWorker(ShardedBatch& batch, Shard& shard) noexcept;
+
+bool StartShardedBatch(
+    ShardedBatch& batch, unsigned numMatches, std::uint32_t seed, unsigned workersPerNode,
+    unsigned actionRepeat) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(!batch.IsValid() && numMatches && actionRepeat, false);
+
+    batch.topology = QueryTopology();
+    batch.actionRepeat = actionRepeat;
+
+    const auto& kTopology = batch.topology;
+
+    // How many workers each node can take.
+    unsigned nodeCapacities[skMaxNodes] = {};
+    auto numShards = 0u;
+
+    for (auto i = 0u; i < kTopology.numNodes; ++i)
+    {
+        nodeCapacities[i] = workersPerNode ? workersPerNode : kTopology.nodes[i].numCpus;
+        numShards += nodeCapacities[i];
+    }
+
+    // Every shard has at least one match.
+    numShards = numShards < numMatches ? numShards : numMatches;
+
+    batch.shards = new (std::nothrow) Shard[numShards];
+    batch.workers = new (std::nothrow) std::thread[numShards];
+
+    if (!batch.shards || !batch.workers)
+    {
+        DestroyShardedBatch(batch);
+        return false;
+    }
+
+    batch.numShards = numShards;
+
+    // Nodes take turns so that a batch with fewer shards than processors is still spread across all of them, and a
+    // node that is full sits the next turns out so that nodes of different sizes each get as many workers as they
+    // have processors.
+    auto node = 0u;
+    auto firstMatch = 0u;
+
+    for (auto i = 0u; i < numShards; ++i)
+    {
+        while (!nodeCapacities[node])
+        {
+            node = (node + 1u) % kTopology.numNodes;
+        }
+
+        --nodeCapacities[node];
+
+        auto& shard = batch.shards[i];
+
+        shard.node = node;
+        node = (node + 1u) % kTopology.numNodes;
+
+        shard.numMatches = numMatches / numShards + (i < numMatches % numShards ? 1u : 0u);
+        shard.seed = seed + firstMatch;
+
+        firstMatch += shard.numMatches;
+    }
+
+    batch.stopping.store(false, std::memory_order_relaxed);
+
+    for (auto i = 0u; i < numShards; ++i)
+    {
+        batch.workers[i] = std::thread(RunWorker, std::ref(batch), std::ref(batch.shards[i]));
+    }
+
+    return true;
+}
+
+void RunWorker(ShardedBatch& batch, Shard& shard) noexcept
+{
+    // Single node hosts don't pay for a system call that wouldn't change where anything runs.
+    shard.pinned = !batch.topology.IsNuma() || PinCurrentThread(batch.topology.nodes[shard.node]);
+
+    const auto kNumMatches = shard.numMatches;
+
+    // MakeBatch clears and initializes the arrays, so their pages are placed on the node this thread runs on.
+    auto matches = MakeBatch(kNumMatches, shard.seed);
+
+    // The actions only live for a decision, they go in this worker's own arena.
+    auto arena = FrameArena::MakeArena(
+        "shard", kNumMatches * sizeof(Action) * 2u, FrameArena::OverflowPolicy::ReturnNull);
+
+    const auto kRewards = static_cast<float*>(AllocateArrays(kNumMatches * sizeof(float)));
+
+    const auto kObservations = static_cast<float*>(
+        AllocateArrays(static_cast<std::size_t>(kNumMatches) * skObservationSize * sizeof(float)));
+
+    shard.allocated = matches.IsValid() && arena.IsValid() && kRewards && kObservations;
+
+    if (shard.allocated)
+    {
+        FrameArena::BindThreadArena(&arena);
+
+        using Clock = std::chrono::steady_clock;
+        const auto kStart = Clock::now();
+
+        // Neighbouring shards share cache lines, the counter stays local until the end.
+        std::uint64_t numDecisions = 0u;
+
+        while (!batch.stopping.load(std::memory_order_relaxed))
+        {
+            FrameArena::BeginFrame(arena);
+
+            const auto kPlayer1Actions = FrameArena::AllocateArray<Action>(arena, kNumMatches * 2u);
+            const auto kPlayer2Actions = kPlayer1Actions + kNumMatches;
+
+            ComputeTrackingActions(matches, kPlayer1Actions, kPlayer2Actions);
+            StepRepeated(matches, kPlayer1Actions, kPlayer2Actions, batch.actionRepeat, kRewards, kObservations);
+
+            ++numDecisions;
+        }
+
+        shard.numDecisions = numDecisions;
+        shard.elapsed = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - kStart).count());
+
+        shard.numTicks = matches.numSteps;
+        shard.numFinishedMatches = matches.numFinishedMatches;
+
+        FrameArena::BindThreadArena(nullptr);
+    }
+
+    FrameArena::DestroyArena(arena);
+    FreeArrays(kObservations);
+    FreeArrays(kRewards);
+    DestroyBatch(matches);
+}
+
+void StopShardedBatch(ShardedBatch& batch) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(batch.IsValid());
+
+    batch.stopping.store(true, std::memory_order_relaxed);
+
+    for (auto i = 0u; i < batch.numShards; ++i)
+    {
+        if (batch.workers[i].joinable())
+        {
+            batch.workers[i].join();
+        }
+    }
+}
+
+void DestroyShardedBatch(ShardedBatch& batch) noexcept
+{
+    StopShardedBatch(batch);
+
+    delete[] batch.workers;
+    delete[] batch.shards;
+
+    batch.workers = nullptr;
+    batch.shards = nullptr;
+    batch.numShards = 0u;
+}
+
+NodeThroughput GetNodeThroughput(const ShardedBatch& batch, unsigned node) noexcept
+{
+    NodeThroughput throughput;
+
+    for (auto i = 0u; i < batch.numShards; ++i)
+    {
+        const auto& kShard = batch.shards[i];
+
+        if (kShard.node != node)
+        {
+            continue;
+        }
+
+        ++throughput.numWorkers;
+        throughput.numMatches += kShard.numMatches;
+        throughput.numFinishedMatches += kShard.numFinishedMatches;
+
+        throughput.pinned &= kShard.pinned;
+        throughput.allocated &= kShard.allocated;
+
+        if (kShard.elapsed)
+        {
+            const auto kSeconds = static_cast<double>(kShard.elapsed) / 1e9;
+
+            throughput.matchDecisionsPerSecond += static_cast<double>(kShard.numDecisions) * kShard.numMatches / kSeconds;
+            throughput.matchTicksPerSecond += static_cast<double>(kShard.numTicks) * kShard.numMatches / kSeconds;
+        }
+    }
+
+    return throughput;
+}
+
+} // namespace lepong::Batch
@@ -0,0 +1,107 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cstring>
+#include <initializer_list>
+
+#include "lepong/Check.h"
+
+#include "lepong/Batch/Snapshot.h"
+
+namespace lepong::Batch
+{
+
+// Set in the middle index when it holds a snapshot the reader has not acquired yet.
+static constexpr unsigned skFreshBit = 0x4u;
+static constexpr unsigned skIndexMask = 0x3u;
+
+static constexpr auto skNumFloatArrays = 4u;
+static constexpr auto skNumIntegerArrays = 2u;
+
+bool MakeSnapshotExchange(SnapshotExchange& exchange, unsigned numMatches) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(numMatches, false);
+
+    const auto kArraySize = GetArraySize(numMatches);
+    const auto kSnapshotSize = kArraySize * (skNumFloatArrays + skNumIntegerArrays) * sizeof(float);
+
+    exchange.memory = AllocateArrays(kSnapshotSize * 3u);
+    LEPONG_CHECK_OR_RETURN_VAL(exchange.memory, false);
+
+    std::memset(exchange.memory, 0, kSnapshotSize * 3u);
+
+    exchange.numMatches = numMatches;
+
+    auto floats = static_cast<float*>(exchange.memory);
+
+    for (auto& snapshot : exchange.snapshots)
+    {
+        for (auto array : {
+            &snapshot.ballPositionsX, &snapshot.ballPositionsY, &snapshot.paddle1PositionsY, &snapshot.paddle2PositionsY })
+        {
+            *array = floats;
+            floats += kArraySize;
+        }
+
+        auto integers = reinterpret_cast<std::uint32_t*>(floats);
+
+        snapshot.player1Scores = integers;
+        snapshot.player2Scores = integers + kArraySize;
+
+        floats += skNumIntegerArrays * kArraySize;
+        snapshot.step = 0u;
+    }
+
+    exchange.writeIndex = 0u;
+    exchange.readIndex = 1u;
+    exchange.middleIndex.store(2u, std::memory_order_relaxed);
+
+    return true;
+}
+
+void DestroySnapshotExchange(SnapshotExchange& exchange) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(exchange.IsValid());
+
+    FreeArrays(exchange.memory);
+
+    exchange.memory = nullptr;
+    exchange.numMatches = 0u;
+}
+
+void Publish(SnapshotExchange& exchange, const Batch& batch) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(exchange.IsValid() && batch.numMatches == exchange.numMatches);
+
+    auto& snapshot = exchange.snapshots[exchange.writeIndex];
+
+    const auto kFloatSize = batch.numMatches * sizeof(float);
+    const auto kIntegerSize = batch.numMatches * sizeof(std::uint32_t);
+
+    std::memcpy(snapshot.ballPositionsX, batch.ballPositionsX, kFloatSize);
+    std::memcpy(snapshot.ballPositionsY, batch.ballPositionsY, kFloatSize);
+    std::memcpy(snapshot.paddle1PositionsY, batch.paddle1PositionsY, kFloatSize);
+    std::memcpy(snapshot.paddle2PositionsY, batch.paddle2PositionsY, kFloatSize);
+    std::memcpy(snapshot.player1Scores, batch.player1Scores, kIntegerSize);
+    std::memcpy(snapshot.player2Scores, batch.player2Scores, kIntegerSize);
+
+    snapshot.step = batch.numSteps;
+
+    // Release the written snapshot and take whichever one was in the middle, possibly an unread one.
+    const auto kPrevious = exchange.middleIndex.exchange(exchange.writeIndex | skFreshBit, std::memory_order_acq_rel);
+    exchange.writeIndex = kPrevious & skIndexMask;
+}
+
+const Snapshot& Acquire(SnapshotExchange& exchange) noexcept
+{
+    if (exchange.middleIndex.load(std::memory_order_relaxed) & skFreshBit)
+    {
+        const auto kPrevious = exchange.middleIndex.exchange(exchange.readIndex, std::memory_order_acq_rel);
+        exchange.readIndex = kPrevious & skIndexMask;
+    }
+
+    return exchange.snapshots[exchange.readIndex];
+}
+
+} // namespace lepong::Batch
@@ -0,0 +1,81 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <thread>
+#include <Windows.h>
+
+#include "lepong/Check.h"
+#include "lepong/Batch/Topology.h"
+
+namespace lepong::Batch
+{
+
+///
+/// \return The whole host as a single node.
+///
+LEPONG_NODISCARD static Topology MakeSingleNode() noexcept;
+
+Topology QueryTopology() noexcept
+{
+    ULONG highestNode = 0;
+    LEPONG_CHECK_OR_RETURN_VAL(GetNumaHighestNodeNumber(&highestNode), MakeSingleNode());
+
+    Topology topology;
+
+    for (ULONG id = 0; id <= highestNode && topology.numNodes < skMaxNodes; ++id)
+    {
+        GROUP_AFFINITY affinity = {};
+
+        // Nodes without processors have an empty mask.
+        if (!GetNumaNodeProcessorMaskEx(static_cast<USHORT>(id), &affinity) || !affinity.Mask)
+        {
+            continue;
+        }
+
+        LEPONG_CHECK_OR_RETURN_VAL(affinity.Group < skMaxCpus / 64u, MakeSingleNode());
+
+        auto& node = topology.nodes[topology.numNodes++];
+        node.id = id;
+        node.cpus[affinity.Group] = affinity.Mask;
+
+        for (auto mask = static_cast<std::uint64_t>(affinity.Mask); mask; mask &= mask - 1u)
+        {
+            ++node.numCpus;
+        }
+    }
+
+    return topology.numNodes ? topology : MakeSingleNode();
+}
+
+Topology MakeSingleNode() noexcept
+{
+    Topology topology;
+    topology.numNodes = 1u;
+
+    // Never pinned, the processors are only counted.
+    const auto kNumCpus = std::thread::hardware_concurrency();
+    topology.nodes[0].numCpus = kNumCpus ? kNumCpus : 1u;
+
+    return topology;
+}
+
+bool PinCurrentThread(const Node& node) noexcept
+{
+    // A thread only runs in one processor group, a node spanning several is pinned to its first.
+    for (auto group = 0u; group < skMaxCpus / 64u; ++group)
+    {
+        if (node.cpus[group])
+        {
+            GROUP_AFFINITY affinity = {};
+            affinity.Group = static_cast<WORD>(group);
+            affinity.Mask = static_cast<KAFFINITY>(node.cpus[group]);
+
+            return SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr);
+        }
+    }
+
+    return false;
+}
+
+} // namespace lepong::Batch
@@ -0,0 +1,133 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <sched.h>
+
+#include "lepong/Check.h"
+#include "lepong/Batch/Topology.h"
+
+namespace lepong::Batch
+{
+
+static constexpr const char* skNodesPath = "/sys/devices/system/node";
+
+///
+/// \return The whole host as a single node.
+///
+LEPONG_NODISCARD static Topology MakeSingleNode() noexcept;
+
+///
+/// Reads a sysfs list such as "0-7,16-23" into one bit per value.
+///
+/// \return Whether the file was read and every value fits.
+///
+LEPONG_NODISCARD static bool ReadList(const char* path, std::uint64_t (&bits)[skMaxCpus / 64u]) noexcept;
+
+Topology QueryTopology() noexcept
+{
+    char path[64];
+    std::snprintf(path, sizeof(path), "%s/online", skNodesPath);
+
+    std::uint64_t online[skMaxCpus / 64u] = {};
+    LEPONG_CHECK_OR_RETURN_VAL(ReadList(path, online), MakeSingleNode());
+
+    Topology topology;
+
+    for (auto id = 0u; id < skMaxCpus && topology.numNodes < skMaxNodes; ++id)
+    {
+        if (!(online[id / 64u] & (1ull << (id % 64u))))
+        {
+            continue;
+        }
+
+        auto& node = topology.nodes[topology.numNodes];
+        node = Node{};
+        node.id = id;
+
+        std::snprintf(path, sizeof(path), "%s/node%u/cpulist", skNodesPath, id);
+        LEPONG_CHECK_OR_RETURN_VAL(ReadList(path, node.cpus), MakeSingleNode());
+
+        for (auto mask : node.cpus)
+        {
+            node.numCpus += static_cast<unsigned>(__builtin_popcountll(mask));
+        }
+
+        // Memory only nodes have an empty list.
+        topology.numNodes += node.numCpus ? 1u : 0u;
+    }
+
+    return topology.numNodes ? topology : MakeSingleNode();
+}
+
+Topology MakeSingleNode() noexcept
+{
+    Topology topology;
+    topology.numNodes = 1u;
+
+    // Never pinned, the processors are only counted.
+    const auto kNumCpus = std::thread::hardware_concurrency();
+    topology.nodes[0].numCpus = kNumCpus ? kNumCpus : 1u;
+
+    return topology;
+}
+
+bool ReadList(const char* path, std::uint64_t (&bits)[skMaxCpus / 64u]) noexcept
+{
+    const auto kFile = std::fopen(path, "r");
+    LEPONG_CHECK_OR_RETURN_VAL(kFile, false);
+
+    char list[1024] = {};
+    const auto kRead = std::fgets(list, sizeof(list), kFile) != nullptr;
+
+    std::fclose(kFile);
+    LEPONG_CHECK_OR_RETURN_VAL(kRead, false);
+
+    for (auto cursor = list; *cursor && *cursor != '\n';)
+    {
+        char* end = nullptr;
+        const auto kFirst = std::strtoul(cursor, &end, 10);
+        LEPONG_CHECK_OR_RETURN_VAL(end != cursor, false);
+
+        auto last = kFirst;
+
+        if (*end == '-')
+        {
+            cursor = end + 1;
+            last = std::strtoul(cursor, &end, 10);
+            LEPONG_CHECK_OR_RETURN_VAL(end != cursor, false);
+        }
+
+        LEPONG_CHECK_OR_RETURN_VAL(kFirst <= last && last < skMaxCpus, false);
+
+        for (auto value = kFirst; value <= last; ++value)
+        {
+            bits[value / 64u] |= 1ull << (value % 64u);
+        }
+
+        cursor = (*end == ',') ? end + 1 : end;
+    }
+
+    return true;
+}
+
+bool PinCurrentThread(const Node& node) noexcept
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+
+    for (auto cpu = 0u; cpu < skMaxCpus && cpu < CPU_SETSIZE; ++cpu)
+    {
+        if (node.cpus[cpu / 64u] & (1ull << (cpu % 64u)))
+        {
+            CPU_SET(cpu, &set);
+        }
+    }
+
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+}
+
+} // namespace lepong::Batch
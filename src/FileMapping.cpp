@@ -0,0 +1,98 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <Windows.h>
+
+#include "lepong/Check.h"
+#include "lepong/FileMapping.h"
+
+namespace lepong::FileMapping
+{
+
+///
+/// Maps <i>size</i> bytes of the provided file. The file handle is closed on failure.
+///
+LEPONG_NODISCARD static Mapping MapFile(HANDLE file, std::size_t size, bool writable) noexcept;
+
+Mapping MakeReadOnlyMapping(const char* path) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(path, Mapping{});
+
+    const auto kFile = CreateFileA(
+        path,
+        GENERIC_READ,
+        FILE_SHARE_READ | FILE_SHARE_WRITE, // The file may still be appended to by a writer.
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr);
+
+    LEPONG_CHECK_OR_RETURN_VAL(kFile != INVALID_HANDLE_VALUE, Mapping{});
+
+    LARGE_INTEGER fileSize = {};
+    GetFileSizeEx(kFile, &fileSize);
+
+    return MapFile(kFile, static_cast<std::size_t>(fileSize.QuadPart), false);
+}
+
+Mapping MakeReadWriteMapping(const char* path, std::size_t size) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(path && size, Mapping{});
+
+    const auto kFile = CreateFileA(
+        path,
+        GENERIC_READ | GENERIC_WRITE,
+        FILE_SHARE_READ | FILE_SHARE_WRITE,
+        nullptr,
+        OPEN_ALWAYS,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr);
+
+    LEPONG_CHECK_OR_RETURN_VAL(kFile != INVALID_HANDLE_VALUE, Mapping{});
+
+    // Mapping a file for writing past its end grows it.
+    return MapFile(kFile, size, true);
+}
+
+Mapping MapFile(HANDLE file, std::size_t size, bool writable) noexcept
+{
+    const auto kSize = static_cast<ULONGLONG>(size);
+
+    const auto kMapping = size ? CreateFileMappingW(
+        file,
+        nullptr,
+        writable ? PAGE_READWRITE : PAGE_READONLY,
+        static_cast<DWORD>(kSize >> 32u), static_cast<DWORD>(kSize),
+        nullptr) : nullptr;
+
+    const auto kData = kMapping
+        ? MapViewOfFile(kMapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size)
+        : nullptr;
+
+    if (!kData)
+    {
+        if (kMapping)
+        {
+            CloseHandle(kMapping);
+        }
+
+        CloseHandle(file);
+        return {};
+    }
+
+    return { kData, size, file, kMapping };
+}
+
+void DestroyMapping(Mapping& mapping) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(mapping.data);
+
+    UnmapViewOfFile(mapping.data);
+    CloseHandle(mapping.mapping);
+    CloseHandle(mapping.file);
+
+    mapping = {};
+}
+
+} // namespace lepong::FileMapping
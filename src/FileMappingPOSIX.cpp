@@ -0,0 +1,76 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "lepong/Check.h"
+#include "lepong/FileMapping.h"
+
+namespace lepong::FileMapping
+{
+
+///
+/// Maps <i>size</i> bytes of the provided file. The file descriptor is closed in every case, the mapping keeps the
+/// file open.
+///
+LEPONG_NODISCARD static Mapping MapFile(int file, std::size_t size, bool writable) noexcept;
+
+Mapping MakeReadOnlyMapping(const char* path) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(path, Mapping{});
+
+    const auto kFile = open(path, O_RDONLY | O_CLOEXEC);
+    LEPONG_CHECK_OR_RETURN_VAL(kFile != -1, Mapping{});
+
+    struct stat status = {};
+    const auto kSize = fstat(kFile, &status) == 0 ? static_cast<std::size_t>(status.st_size) : 0u;
+
+    return MapFile(kFile, kSize, false);
+}
+
+Mapping MakeReadWriteMapping(const char* path, std::size_t size) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(path && size, Mapping{});
+
+    const auto kFile = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    LEPONG_CHECK_OR_RETURN_VAL(kFile != -1, Mapping{});
+
+    // Unlike on Windows, mapping past the end of a file doesn't grow it.
+    struct stat status = {};
+    auto grown = fstat(kFile, &status) == 0;
+
+    if (grown && static_cast<std::size_t>(status.st_size) < size)
+    {
+        grown = ftruncate(kFile, static_cast<off_t>(size)) == 0;
+    }
+
+    return MapFile(kFile, grown ? size : 0u, true);
+}
+
+Mapping MapFile(int file, std::size_t size, bool writable) noexcept
+{
+    const auto kData = size
+        ? mmap(nullptr, size, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, file, 0)
+        : MAP_FAILED;
+
+    close(file);
+
+    LEPONG_CHECK_OR_RETURN_VAL(kData != MAP_FAILED, Mapping{});
+
+    // The handles stay null, the mapping alone is enough to unmap.
+    return { kData, size, nullptr, nullptr };
+}
+
+void DestroyMapping(Mapping& mapping) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(mapping.data);
+
+    munmap(mapping.data, mapping.size);
+    mapping = {};
+}
+
+} // namespace lepong::FileMapping
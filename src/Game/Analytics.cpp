@@ -0,0 +1,201 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cstdio>
+
+#include "lepong/Check.h"
+#include "lepong/Game/Analytics.h"
+
+namespace lepong::Analytics
+{
+
+static FILE* sFile = nullptr;
+
+// The file's buffer, the C library would otherwise allocate one on the first write.
+static char sFileBuffer[64u * 1024u];
+
+bool Init() noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(!sFile, false);
+
+    const auto kOpened = !fopen_s(&sFile, "lepong.analytics", "ab");
+    LEPONG_CHECK_OR_LOG(kOpened, "Failed to open the analytics file");
+
+    if (kOpened)
+    {
+        std::setvbuf(sFile, sFileBuffer, _IOFBF, sizeof(sFileBuffer));
+    }
+
+    return kOpened;
+}
+
+void Cleanup() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sFile);
+
+    std::fclose(sFile);
+    sFile = nullptr;
+}
+
+void BeginMatch(MatchAnalytics& analytics, std::uint32_t seed) noexcept
+{
+    analytics.seed = seed;
+    analytics.recordingChunk = 0u;
+    analytics.writePending = false;
+    analytics.numDroppedEvents = 0u;
+
+    for (auto& chunk : analytics.chunks)
+    {
+        chunk.numHits = 0u;
+        chunk.numPoints = 0u;
+    }
+}
+
+///
+/// Swaps the recording chunk with the waiting one, which must have been written.
+///
+/// \return The new recording chunk, or nullptr if the waiting chunk was not written yet.
+///
+LEPONG_NODISCARD static Chunk* SwapChunks(MatchAnalytics& analytics) noexcept;
+
+///
+/// Records a paddle hit.
+///
+static void OnPaddleHit(void* user, const Match& match, Side side, float hitSpeed) noexcept;
+
+///
+/// Records a point.
+///
+static void OnPoint(void* user, const Match& match, Side lostSide) noexcept;
+
+MatchListener MakeListener(MatchAnalytics& analytics) noexcept
+{
+    MatchListener listener;
+    listener.user = &analytics;
+    listener.onPaddleHit = OnPaddleHit;
+    listener.onPoint = OnPoint;
+
+    return listener;
+}
+
+Chunk* SwapChunks(MatchAnalytics& analytics) noexcept
+{
+    if (analytics.writePending)
+    {
+        // Only a frame with thousands of events gets here.
+        ++analytics.numDroppedEvents;
+        return nullptr;
+    }
+
+    analytics.writePending = true;
+    analytics.recordingChunk ^= 1u;
+
+    return &analytics.chunks[analytics.recordingChunk];
+}
+
+void OnPaddleHit(void* user, const Match& match, Side side, float hitSpeed) noexcept
+{
+    auto& analytics = *static_cast<MatchAnalytics*>(user);
+    auto chunk = &analytics.chunks[analytics.recordingChunk];
+
+    if (chunk->numHits == skMaxHits)
+    {
+        chunk = SwapChunks(analytics);
+        LEPONG_CHECK_OR_RETURN(chunk);
+    }
+
+    const auto& kPaddle = side == Side::Player1 ? match.paddle1 : match.paddle2;
+    const auto kIndex = chunk->numHits++;
+
+    chunk->hitTimes[kIndex] = match.time;
+    chunk->hitOffsets[kIndex] = (match.ball.position.y - kPaddle.position.y) / kPaddle.size.y;
+    chunk->hitSpeeds[kIndex] = hitSpeed;
+    chunk->hitSides[kIndex] = static_cast<std::uint8_t>(side);
+}
+
+void OnPoint(void* user, const Match& match, Side lostSide) noexcept
+{
+    auto& analytics = *static_cast<MatchAnalytics*>(user);
+    auto chunk = &analytics.chunks[analytics.recordingChunk];
+
+    if (chunk->numPoints == skMaxPoints)
+    {
+        chunk = SwapChunks(analytics);
+        LEPONG_CHECK_OR_RETURN(chunk);
+    }
+
+    const auto kIndex = chunk->numPoints++;
+
+    chunk->pointTimes[kIndex] = match.time;
+    chunk->timesToPoint[kIndex] = match.time - match.rallyStartTime;
+    chunk->rallyLengths[kIndex] = match.numRallyHits;
+    chunk->lostSides[kIndex] = static_cast<std::uint8_t>(lostSide);
+}
+
+///
+/// Writes the first <i>count</i> values of the provided column.
+///
+template<typename T>
+static void WriteColumn(const T* column, std::uint32_t count) noexcept;
+
+///
+/// Appends the provided chunk to the analytics file and clears it.
+///
+static void WriteChunk(std::uint32_t seed, Chunk& chunk) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(chunk.numHits || chunk.numPoints);
+
+    if (sFile)
+    {
+        ChunkHeader header;
+        header.magic = skChunkMagic;
+        header.seed = seed;
+        header.numHits = chunk.numHits;
+        header.numPoints = chunk.numPoints;
+
+        std::fwrite(&header, sizeof(ChunkHeader), 1, sFile);
+
+        WriteColumn(chunk.hitTimes, chunk.numHits);
+        WriteColumn(chunk.hitOffsets, chunk.numHits);
+        WriteColumn(chunk.hitSpeeds, chunk.numHits);
+        WriteColumn(chunk.hitSides, chunk.numHits);
+
+        WriteColumn(chunk.pointTimes, chunk.numPoints);
+        WriteColumn(chunk.timesToPoint, chunk.numPoints);
+        WriteColumn(chunk.rallyLengths, chunk.numPoints);
+        WriteColumn(chunk.lostSides, chunk.numPoints);
+
+        std::fflush(sFile);
+    }
+
+    // Cleared even without a file, the chunk would stay full otherwise.
+    chunk.numHits = 0u;
+    chunk.numPoints = 0u;
+}
+
+void WritePending(MatchAnalytics& analytics) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(analytics.writePending);
+
+    WriteChunk(analytics.seed, analytics.chunks[analytics.recordingChunk ^ 1u]);
+    analytics.writePending = false;
+}
+
+void Flush(MatchAnalytics& analytics) noexcept
+{
+    // The waiting chunk holds the older events.
+    WritePending(analytics);
+    WriteChunk(analytics.seed, analytics.chunks[analytics.recordingChunk]);
+
+    LEPONG_CHECK_OR_LOG(!analytics.numDroppedEvents, "Analytics events were dropped, both chunks filled up in a frame");
+    analytics.numDroppedEvents = 0u;
+}
+
+template<typename T>
+void WriteColumn(const T* column, std::uint32_t count) noexcept
+{
+    std::fwrite(column, sizeof(T), count, sFile);
+}
+
+} // namespace lepong::Analytics
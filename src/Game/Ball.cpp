@@ -162,4 +162,33 @@ GLuint MakeBallFragmentShader() noexcept
     return Graphics::CreateShaderFromSource(gl::FragmentShader, kSource);
 }
 
+GLuint MakeBallCoreFragmentShader() noexcept
+{
+    constexpr auto kSource =
+    R"(
+
+    #version 330 core
+
+    in vec2 vTextureCoords;
+
+    out vec4 FragColor;
+
+    void main()
+    {
+        vec2 textureCoordsCentered = vTextureCoords * 2.0 - vec2(1.0);
+
+        // A solid disc. The corners must not cover the glow drawn before the ball.
+        if (dot(textureCoordsCentered, textureCoordsCentered) > 1.0)
+        {
+            discard;
+        }
+
+        FragColor = vec4(1.0);
+    }
+
+    )";
+
+    return Graphics::CreateShaderFromSource(gl::FragmentShader, kSource);
+}
+
 } // namespace lepong
@@ -0,0 +1,292 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <Windows.h>
+
+#include "lepong/Check.h"
+#include "lepong/Log.h"
+#include "lepong/Game/Ball.h"
+#include "lepong/Game/GridViewer.h"
+#include "lepong/Game/Match.h"
+#include "lepong/Game/Paddle.h"
+#include "lepong/Graphics/Quad.h"
+#include "lepong/Memory/FrameArena.h"
+#include "lepong/Time/Time.h"
+
+namespace lepong::GridViewer
+{
+
+// The position and size of a quad.
+static constexpr GLuint skInstanceLayout[] = { 4 };
+static constexpr auto skInstanceSize = 4u;
+
+static constexpr auto skInstancesPerMatch = 3u;
+
+// The instances are rewritten every frame in the main thread's frame arena.
+static_assert(
+    skMaxGridSize * skMaxGridSize * skInstancesPerMatch * skInstanceSize * sizeof(float) <= FrameArena::skMainArenaSize);
+
+unsigned GetSelectedGridSize() noexcept
+{
+    char value[8] = {};
+    GetEnvironmentVariableA(skSelectionVariable, value, sizeof(value));
+
+    const auto kGridSize = std::strtoul(value, nullptr, 10);
+    return kGridSize <= skMaxGridSize ? static_cast<unsigned>(kGridSize) : skMaxGridSize;
+}
+
+///
+/// Creates the programs and meshes used to draw the instances.
+///
+/// \return Whether every resource was created.
+///
+LEPONG_NODISCARD static bool MakeRenderingResources(Viewer& viewer) noexcept;
+
+///
+/// Steps the batch and publishes its state until the viewer is stopped.
+///
+static void Simulate(Viewer& viewer) noexcept;
+
+bool MakeViewer(Viewer& viewer, unsigned gridSize, const Vector2i& winSize) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(gridSize && gridSize <= skMaxGridSize, false);
+
+    const auto kNumMatches = gridSize * gridSize;
+
+    viewer.gridSize = gridSize;
+    viewer.winSize = winSize;
+
+    viewer.batch = Batch::MakeBatch(kNumMatches, static_cast<std::uint32_t>(Time::GetNanoseconds()));
+
+    const auto kCreated =
+        viewer.batch.IsValid() &&
+        Batch::MakeSnapshotExchange(viewer.exchange, kNumMatches) &&
+        MakeRenderingResources(viewer);
+
+    if (!kCreated)
+    {
+        DestroyViewer(viewer);
+        return false;
+    }
+
+    // Something to draw before the first step.
+    Batch::Publish(viewer.exchange, viewer.batch);
+
+    viewer.startTime = Time::GetNanoseconds();
+    viewer.stopping.store(false, std::memory_order_relaxed);
+    viewer.simulationThread = std::thread(Simulate, std::ref(viewer));
+
+    return true;
+}
+
+///
+/// Creates a program using the provided shaders, then destroys them.
+///
+LEPONG_NODISCARD static GLuint CreateInstancedProgram(GLuint vertex, GLuint fragment) noexcept;
+
+bool MakeRenderingResources(Viewer& viewer) noexcept
+{
+    viewer.paddleProgram = CreateInstancedProgram(
+        Graphics::MakeInstancedQuadVertexShader(), MakePaddleFragmentShader());
+
+    viewer.ballProgram = CreateInstancedProgram(
+        Graphics::MakeInstancedTexturedQuadVertexShader(), MakeBallFragmentShader());
+
+    // The viewer's own meshes, the instance attributes would be shared with the local match's otherwise.
+    viewer.quad = Graphics::MakeSimpleQuad();
+    viewer.texturedQuad = Graphics::MakeTexturedQuad();
+
+    gl::GenBuffers(1, &viewer.instanceBuffer);
+
+    LEPONG_CHECK_OR_RETURN_VAL(
+        viewer.paddleProgram && viewer.ballProgram &&
+        viewer.quad.IsValid() && viewer.texturedQuad.IsValid() &&
+        viewer.instanceBuffer, false);
+
+    const auto kNumMatches = viewer.gridSize * viewer.gridSize;
+    const auto kInstanceBufferSize = kNumMatches * skInstancesPerMatch * skInstanceSize * sizeof(float);
+
+    gl::BindBuffer(gl::ArrayBuffer, viewer.instanceBuffer);
+    gl::BufferData(gl::ArrayBuffer, kInstanceBufferSize, nullptr, gl::StreamDraw);
+
+    // Two paddles per match then one ball per match.
+    const GLsizeiptr kBallsOffset = kNumMatches * 2u * skInstanceSize * sizeof(float);
+
+    Graphics::SetMeshInstanceLayout(viewer.quad, viewer.instanceBuffer, 0, Graphics::skQuadInstanceAttribute, skInstanceLayout);
+    Graphics::SetMeshInstanceLayout(
+        viewer.texturedQuad, viewer.instanceBuffer, kBallsOffset, Graphics::skQuadInstanceAttribute, skInstanceLayout);
+
+    return true;
+}
+
+GLuint CreateInstancedProgram(GLuint vertex, GLuint fragment) noexcept
+{
+    const auto kProgram = Graphics::CreateProgramFromShaders(vertex, fragment);
+
+    gl::DeleteShader(vertex);
+    gl::DeleteShader(fragment);
+
+    return kProgram;
+}
+
+void Simulate(Viewer& viewer) noexcept
+{
+    auto& batch = viewer.batch;
+    const auto kNumMatches = batch.numMatches;
+
+    // The actions only live for a decision, they go in this thread's own arena.
+    auto arena = FrameArena::MakeArena(
+        "grid simulation", kNumMatches * sizeof(Batch::Action) * 2u, FrameArena::OverflowPolicy::ReturnNull);
+
+    FrameArena::BindThreadArena(&arena);
+
+    while (arena.IsValid() && !viewer.stopping.load(std::memory_order_relaxed))
+    {
+        FrameArena::BeginFrame(arena);
+
+        const auto kPlayer1Actions = FrameArena::AllocateArray<Batch::Action>(arena, kNumMatches * 2u);
+        const auto kPlayer2Actions = kPlayer1Actions + kNumMatches;
+
+        Batch::ComputeTrackingActions(batch, kPlayer1Actions, kPlayer2Actions);
+
+        // Nothing looks at the intermediate ticks, they only simulate.
+        Batch::StepRepeated(batch, kPlayer1Actions, kPlayer2Actions, skActionRepeat, nullptr, nullptr);
+
+        // Never waits for the viewer.
+        Batch::Publish(viewer.exchange, batch);
+    }
+
+    LEPONG_CHECK_OR_LOG(arena.IsValid(), "Failed to allocate the grid simulation's frame arena");
+
+    FrameArena::BindThreadArena(nullptr);
+    FrameArena::DestroyArena(arena);
+}
+
+///
+/// Logs how fast the batch was simulated.
+///
+static void LogSimulationRate(const Viewer& viewer) noexcept;
+
+void DestroyViewer(Viewer& viewer) noexcept
+{
+    if (viewer.simulationThread.joinable())
+    {
+        viewer.stopping.store(true, std::memory_order_relaxed);
+        viewer.simulationThread.join();
+
+        LogSimulationRate(viewer);
+    }
+
+    gl::DeleteBuffers(1, &viewer.instanceBuffer);
+    viewer.instanceBuffer = 0;
+
+    Graphics::DestroyMesh(viewer.texturedQuad);
+    Graphics::DestroyMesh(viewer.quad);
+
+    gl::DeleteProgram(viewer.ballProgram);
+    gl::DeleteProgram(viewer.paddleProgram);
+
+    viewer.ballProgram = 0;
+    viewer.paddleProgram = 0;
+
+    Batch::DestroySnapshotExchange(viewer.exchange);
+
+    Batch::DestroyBatch(viewer.batch);
+}
+
+void LogSimulationRate(const Viewer& viewer) noexcept
+{
+    const auto kElapsed = static_cast<double>(Time::GetNanoseconds() - viewer.startTime) / 1e9;
+    const auto kNumSteps = static_cast<double>(viewer.batch.numSteps);
+
+    char message[160];
+    std::snprintf(
+        message, sizeof(message), "Grid viewer: %u matches, %.0f steps/s, %.0f match steps/s, %llu finished matches",
+        viewer.batch.numMatches, kNumSteps / kElapsed, kNumSteps * viewer.batch.numMatches / kElapsed,
+        static_cast<unsigned long long>(viewer.batch.numFinishedMatches));
+
+    Log::Log(message);
+}
+
+///
+/// Writes a quad instance and returns where the next one goes.
+///
+LEPONG_NODISCARD static float* WriteInstance(float* instance, float x, float y, float width, float height) noexcept;
+
+void Render(Viewer& viewer) noexcept
+{
+    const auto& kSnapshot = Batch::Acquire(viewer.exchange);
+
+    const auto kGridSize = viewer.gridSize;
+    const auto kNumMatches = kGridSize * kGridSize;
+
+    const auto kTileWidth = static_cast<float>(viewer.winSize.x) / static_cast<float>(kGridSize);
+    const auto kTileHeight = static_cast<float>(viewer.winSize.y) / static_cast<float>(kGridSize);
+
+    // Keep the terrain's aspect ratio so the balls stay round.
+    const auto kScale = std::min(
+        kTileWidth / static_cast<float>(Match::skTerrainSize.x), kTileHeight / static_cast<float>(Match::skTerrainSize.y));
+
+    const auto kInstanceCount = kNumMatches * skInstancesPerMatch * skInstanceSize;
+    const auto kArena = FrameArena::GetThreadArena();
+    const auto kInstances = kArena ? FrameArena::AllocateArray<float>(*kArena, kInstanceCount) : nullptr;
+
+    // The arena only runs out if something else used most of it this frame, the frame is then not drawn.
+    LEPONG_CHECK_OR_RETURN(kInstances);
+
+    const auto kPaddleWidth = Match::skPaddleSize.x * kScale;
+    const auto kPaddleHeight = Match::skPaddleSize.y * kScale;
+    const auto kBallDiameter = Match::skBallRadius * 2.0f * kScale;
+
+    auto paddles = kInstances;
+    auto balls = kInstances + kNumMatches * 2u * skInstanceSize;
+
+    for (auto i = 0u; i < kNumMatches; ++i)
+    {
+        const auto kTileX = static_cast<float>(i % kGridSize) * kTileWidth;
+        const auto kTileY = static_cast<float>(i / kGridSize) * kTileHeight;
+
+        paddles = WriteInstance(
+            paddles, kTileX + Batch::skPaddle1PositionX * kScale, kTileY + kSnapshot.paddle1PositionsY[i] * kScale,
+            kPaddleWidth, kPaddleHeight);
+
+        paddles = WriteInstance(
+            paddles, kTileX + Batch::skPaddle2PositionX * kScale, kTileY + kSnapshot.paddle2PositionsY[i] * kScale,
+            kPaddleWidth, kPaddleHeight);
+
+        balls = WriteInstance(
+            balls, kTileX + kSnapshot.ballPositionsX[i] * kScale, kTileY + kSnapshot.ballPositionsY[i] * kScale,
+            kBallDiameter, kBallDiameter);
+    }
+
+    const auto kInstanceBufferSize = kInstanceCount * sizeof(float);
+
+    // Orphan last frame's storage so the upload doesn't wait for the draws still reading it.
+    gl::BindBuffer(gl::ArrayBuffer, viewer.instanceBuffer);
+    gl::BufferData(gl::ArrayBuffer, kInstanceBufferSize, nullptr, gl::StreamDraw);
+    gl::BufferSubData(gl::ArrayBuffer, 0, kInstanceBufferSize, kInstances);
+
+    gl::Clear(gl::ColorBufferBit);
+
+    gl::UseProgram(viewer.paddleProgram);
+    Graphics::DrawMeshInstanced(viewer.quad, static_cast<GLsizei>(kNumMatches * 2u));
+
+    gl::UseProgram(viewer.ballProgram);
+    Graphics::DrawMeshInstanced(viewer.texturedQuad, static_cast<GLsizei>(kNumMatches));
+}
+
+float* WriteInstance(float* instance, float x, float y, float width, float height) noexcept
+{
+    instance[0] = x;
+    instance[1] = y;
+    instance[2] = width;
+    instance[3] = height;
+
+    return instance + skInstanceSize;
+}
+
+} // namespace lepong::GridViewer
@@ -0,0 +1,256 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include "lepong/Math/Math.h"
+
+#include "lepong/Game/Match.h"
+
+namespace lepong
+{
+
+Match::Match(Graphics::Mesh& quad, Graphics::Mesh& texturedQuad, GLuint& paddleProgram, GLuint& ballProgram) noexcept
+    : ball(skBallRadius, texturedQuad, ballProgram)
+    , paddle1(skPaddleSize,  1.0f, quad, paddleProgram)
+    , paddle2(skPaddleSize, -1.0f, quad, paddleProgram)
+{
+}
+
+void Match::Start() noexcept
+{
+    Reset();
+
+    playerScores[0] = 0u;
+    playerScores[1] = 0u;
+
+    tick = 0u;
+    time = 0.0f;
+    numRallies = 0u;
+    numPaddleHits = 0u;
+
+    rallyStartTime = 0.0f;
+    numRallyHits = 0u;
+
+    const auto kBorderOffset = 50.0f;
+
+    paddle1.position.x = kBorderOffset;
+    paddle2.position.x = skTerrainSize.x - kBorderOffset;
+}
+
+void Match::OnKeyEvent(int key, bool pressed) noexcept
+{
+    if (playing)
+    {
+        if (pressed)
+        {
+            OnKeyDown(key);
+        }
+        else
+        {
+            OnKeyUp(key);
+        }
+    }
+    else if (pressed && key == VK_SPACE)
+    {
+        playing = true;
+        LaunchBall();
+    }
+}
+
+// Ugly input code below.
+
+static constexpr int skP2Up = VK_UP;
+static constexpr int skP2Down = VK_DOWN;
+static constexpr int skP1Up = 'W';
+static constexpr int skP1Down = 'S';
+
+void Match::OnKeyUp(int key) noexcept
+{
+    switch (key)
+    {
+    case skP2Up:
+        paddle2.OnMoveUpReleased();
+        break;
+
+    case skP2Down:
+        paddle2.OnMoveDownReleased();
+        break;
+
+    case skP1Up:
+        paddle1.OnMoveUpReleased();
+        break;
+
+    case skP1Down:
+        paddle1.OnMoveDownReleased();
+        break;
+
+    default: break;
+    }
+}
+
+void Match::OnKeyDown(int key) noexcept
+{
+    switch (key)
+    {
+    case skP2Up:
+        paddle2.OnMoveUpPressed();
+        break;
+
+    case skP2Down:
+        paddle2.OnMoveDownPressed();
+        break;
+
+    case skP1Up:
+        paddle1.OnMoveUpPressed();
+        break;
+
+    case skP1Down:
+        paddle1.OnMoveDownPressed();
+        break;
+
+    default: break;
+    }
+}
+
+void Match::LaunchBall() noexcept
+{
+    ++numRallies;
+
+    rallyStartTime = time;
+    numRallyHits = 0u;
+
+    ball.moveSpeed = Ball::skDefaultMoveSpeed;
+
+    ball.moveDirection = { RandomSignFloat(), RandomSignFloat() };
+    ball.moveDirection = Normalize(ball.moveDirection);
+}
+
+void Match::Update(float delta) noexcept
+{
+    ++tick;
+    time += delta;
+
+    ball.Update(delta);
+
+    paddle1.Update(delta, skTerrainSize);
+    paddle2.Update(delta, skTerrainSize);
+
+    ball.CollideWithTerrain(skTerrainSize);
+
+    const auto kCollides =
+        CollideBallWith(paddle1, Side::Player1) ||
+        CollideBallWith(paddle2, Side::Player2);
+
+    if (!kCollides)
+    {
+        CheckBallSideCollision();
+    }
+}
+
+bool Match::CollideBallWith(const Paddle& paddle, Side side) noexcept
+{
+    const auto kHitSpeed = ball.moveSpeed;
+    const auto kCollides = ball.CollideWith(paddle);
+
+    if (kCollides)
+    {
+        ++numPaddleHits;
+        ++numRallyHits;
+
+        if (listener.onPaddleHit)
+        {
+            listener.onPaddleHit(listener.user, *this, side, kHitSpeed);
+        }
+    }
+
+    return kCollides;
+}
+
+void Match::CheckBallSideCollision() noexcept
+{
+    const auto kSide = ball.GetTouchingSide(skTerrainSize);
+
+    if (kSide != Side::None)
+    {
+        if (listener.onPoint)
+        {
+            listener.onPoint(listener.user, *this, kSide);
+        }
+
+        // The player who won the point is the player opposite to the touched side.
+        const auto kScoreIndex = 1u - static_cast<unsigned>(kSide);
+        ++playerScores[kScoreIndex];
+
+        Reset();
+
+        if (playerScores[kScoreIndex] == skWinningScore && listener.onMatchEnd)
+        {
+            listener.onMatchEnd(listener.user, *this, static_cast<Side>(kScoreIndex));
+        }
+    }
+}
+
+void Match::Reset() noexcept
+{
+    ball.Reset(skTerrainSize);
+
+    paddle1.Reset(skTerrainSize);
+    paddle2.Reset(skTerrainSize);
+
+    playing = false;
+}
+
+State Match::CaptureState() const noexcept
+{
+    State state;
+
+    state.ballPosition = ball.position;
+    state.ballMoveDirection = ball.moveDirection;
+    state.ballMoveSpeed = ball.moveSpeed;
+
+    state.paddle1Position = paddle1.position;
+    state.paddle1MoveDirectionY = paddle1.moveDirection.y;
+    state.paddle1MoveSpeed = paddle1.moveSpeed;
+
+    state.paddle2Position = paddle2.position;
+    state.paddle2MoveDirectionY = paddle2.moveDirection.y;
+    state.paddle2MoveSpeed = paddle2.moveSpeed;
+
+    state.playerScores[0] = playerScores[0];
+    state.playerScores[1] = playerScores[1];
+    state.playing = playing;
+    state.randomState = GetRandomState();
+
+    return state;
+}
+
+void Match::RestoreState(const State& state) noexcept
+{
+    ball.position = state.ballPosition;
+    ball.moveDirection = state.ballMoveDirection;
+    ball.moveSpeed = state.ballMoveSpeed;
+
+    paddle1.position = state.paddle1Position;
+    paddle1.moveDirection.y = state.paddle1MoveDirectionY;
+    paddle1.moveSpeed = state.paddle1MoveSpeed;
+
+    paddle2.position = state.paddle2Position;
+    paddle2.moveDirection.y = state.paddle2MoveDirectionY;
+    paddle2.moveSpeed = state.paddle2MoveSpeed;
+
+    playerScores[0] = state.playerScores[0];
+    playerScores[1] = state.playerScores[1];
+    playing = state.playing != 0u;
+    SeedRandom(state.randomState);
+}
+
+// Headless matches are never rendered, they only need something to reference.
+static Graphics::Mesh sHeadlessMesh;
+static GLuint sHeadlessProgram = 0;
+
+Match MakeHeadlessMatch() noexcept
+{
+    return { sHeadlessMesh, sHeadlessMesh, sHeadlessProgram, sHeadlessProgram };
+}
+
+} // namespace lepong
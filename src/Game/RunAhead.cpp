@@ -0,0 +1,142 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <Windows.h>
+
+#include "lepong/Check.h"
+#include "lepong/Game/RunAhead.h"
+#include "lepong/Time/Profiler.h"
+#include "lepong/Time/Time.h"
+
+namespace lepong::RunAhead
+{
+
+unsigned GetSelectedTicks() noexcept
+{
+    char value[4] = {};
+    GetEnvironmentVariableA(skSelectionVariable, value, sizeof(value));
+
+    const auto kTicks = std::strtol(value, nullptr, 10);
+    return static_cast<unsigned>(std::clamp(kTicks, 0l, static_cast<long>(skMaxTicks)));
+}
+
+Predictor MakePredictor(unsigned maxTicks) noexcept
+{
+    Predictor predictor;
+    predictor.maxTicks = std::min(maxTicks, skMaxTicks);
+
+    return predictor;
+}
+
+void LogSummary(const Predictor& predictor) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(predictor.IsValid());
+
+    char message[96];
+
+    std::snprintf(
+        message, sizeof(message), "Run-ahead: %llu of %llu frames predicted",
+        static_cast<unsigned long long>(predictor.numPredictedFrames),
+        static_cast<unsigned long long>(predictor.numFrames));
+
+    Log::Log(message);
+}
+
+///
+/// Smooths a measurement, each new one counts for a quarter so a single slow tick or frame changes nothing.
+///
+LEPONG_NODISCARD static std::uint64_t Smooth(std::uint64_t average, std::uint64_t measurement) noexcept;
+
+void RecordTick(Predictor& predictor, std::uint64_t nanoseconds) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(predictor.IsValid());
+
+    predictor.tickCost = Smooth(predictor.tickCost, nanoseconds);
+}
+
+std::uint64_t Smooth(std::uint64_t average, std::uint64_t measurement) noexcept
+{
+    return average ? (average * 3u + measurement) / 4u : measurement;
+}
+
+void Adjust(Predictor& predictor, std::uint64_t frameTime) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(predictor.IsValid() && frameTime);
+
+    predictor.frameTime = Smooth(predictor.frameTime, frameTime);
+
+    // A predicted tick costs at least as much as a real one.
+    const auto kCost = std::max<std::uint64_t>(predictor.tickCost, 1u);
+    const auto kBudget = static_cast<std::uint64_t>(static_cast<float>(predictor.frameTime) * skBudget);
+
+    predictor.numTicks = static_cast<unsigned>(std::min<std::uint64_t>(kBudget / kCost, predictor.maxTicks));
+}
+
+///
+/// Saves the match and silences its listener.
+///
+static void SaveCheckpoint(Checkpoint& checkpoint, Match& match) noexcept;
+
+void BeginPrediction(Predictor& predictor, Match& match, float delta) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(predictor.IsValid() && !predictor.predicting);
+
+    ++predictor.numFrames;
+
+    // Nothing was measured yet, or the host is too slow.
+    LEPONG_CHECK_OR_RETURN(predictor.numTicks);
+
+    const auto kStart = Time::GetNanoseconds();
+    SaveCheckpoint(predictor.checkpoint, match);
+
+    for (unsigned i = 0; i < predictor.numTicks; ++i)
+    {
+        match.Update(delta);
+    }
+
+    predictor.predicting = true;
+    ++predictor.numPredictedFrames;
+
+    Profiler::Record(Profiler::Timer::RunAhead, Time::GetNanoseconds() - kStart);
+}
+
+void SaveCheckpoint(Checkpoint& checkpoint, Match& match) noexcept
+{
+    checkpoint.state = match.CaptureState();
+
+    checkpoint.tick = match.tick;
+    checkpoint.time = match.time;
+    checkpoint.numRallies = match.numRallies;
+    checkpoint.numPaddleHits = match.numPaddleHits;
+    checkpoint.rallyStartTime = match.rallyStartTime;
+    checkpoint.numRallyHits = match.numRallyHits;
+
+    // The predicted hits and points may never happen.
+    checkpoint.listener = match.listener;
+    match.listener = {};
+}
+
+void EndPrediction(Predictor& predictor, Match& match) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(predictor.predicting);
+
+    const auto& kCheckpoint = predictor.checkpoint;
+
+    match.RestoreState(kCheckpoint.state);
+
+    match.tick = kCheckpoint.tick;
+    match.time = kCheckpoint.time;
+    match.numRallies = kCheckpoint.numRallies;
+    match.numPaddleHits = kCheckpoint.numPaddleHits;
+    match.rallyStartTime = kCheckpoint.rallyStartTime;
+    match.numRallyHits = kCheckpoint.numRallyHits;
+    match.listener = kCheckpoint.listener;
+
+    predictor.predicting = false;
+}
+
+} // namespace lepong::RunAhead
@@ -0,0 +1,146 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <Windows.h>
+
+#include "lepong/Check.h"
+#include "lepong/Game/SdfRenderer.h"
+#include "lepong/Graphics/FrameUniforms.h"
+
+namespace lepong::SdfRenderer
+{
+
+bool IsSelected() noexcept
+{
+    char value[8] = {};
+    GetEnvironmentVariableA(skSelectionVariable, value, sizeof(value));
+
+    return value[0] == 's' && value[1] == 'd' && value[2] == 'f' && value[3] == '\0';
+}
+
+///
+/// Creates a vertex shader that outputs a triangle covering the whole screen, without any vertex data.
+///
+LEPONG_NODISCARD static GLuint MakeFullScreenTriangleVertexShader() noexcept;
+
+///
+/// Creates the fragment shader evaluating the scene.
+///
+LEPONG_NODISCARD static GLuint MakeSceneFragmentShader() noexcept;
+
+Renderer MakeRenderer() noexcept
+{
+    const auto kVertex = MakeFullScreenTriangleVertexShader();
+    const auto kFragment = MakeSceneFragmentShader();
+
+    Renderer renderer;
+    renderer.program = Graphics::CreateProgramFromShaders(kVertex, kFragment);
+
+    gl::DeleteShader(kVertex);
+    gl::DeleteShader(kFragment);
+
+    LEPONG_CHECK_OR_RETURN_VAL(renderer.program, renderer);
+
+    renderer.objectsLocation = gl::GetUniformLocation(renderer.program, "uObjects");
+    gl::GenVertexArrays(1, &renderer.vertexArray);
+
+    return renderer;
+}
+
+GLuint MakeFullScreenTriangleVertexShader() noexcept
+{
+    constexpr auto kSource =
+    R"(
+
+    #version 330 core
+
+    void main()
+    {
+        // (-1, -1), (3, -1) and (-1, 3), the screen is the part of the triangle inside [-1, 1].
+        vec2 position = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2) * 2.0 - vec2(1.0);
+        gl_Position = vec4(position, 0.0, 1.0);
+    }
+
+    )";
+
+    return Graphics::CreateShaderFromSource(gl::VertexShader, kSource);
+}
+
+GLuint MakeSceneFragmentShader() noexcept
+{
+    constexpr auto kSource =
+    R"(
+
+    #version 330 core
+
+    )" LEPONG_GLSL_FRAME_BLOCK R"(
+
+    // In world units. The paddles are center and half size, the ball is center and radius.
+    uniform vec4 uObjects[3];
+
+    out vec4 FragColor;
+
+    // 1 when the pixel center is in [center - half size, center + half size), like a rasterized quad.
+    float BoxCoverage(vec2 position, vec4 box)
+    {
+        vec2 inside = step(box.xy - box.zw, position) * (vec2(1.0) - step(box.xy + box.zw, position));
+        return inside.x * inside.y;
+    }
+
+    void main()
+    {
+        // The projection only scales and translates, it is inverted per component.
+        vec2 clipPosition = gl_FragCoord.xy / uWinSize * 2.0 - vec2(1.0);
+        vec2 position = (clipPosition - uProjection[3].xy) / vec2(uProjection[0][0], uProjection[1][1]);
+
+        // The same glow as the ball fragment shader, over the same square.
+        vec2 ballOffset = (position - uObjects[2].xy) / uObjects[2].z;
+        float squareDistanceToCenter = dot(ballOffset, ballOffset);
+        float inBallQuad = step(max(abs(ballOffset.x), abs(ballOffset.y)), 1.0);
+        float glow = inBallQuad * max(1.0 - pow(squareDistanceToCenter, 3.0), 0.0);
+
+        // The paddles are opaque white.
+        float paddle = max(BoxCoverage(position, uObjects[0]), BoxCoverage(position, uObjects[1]));
+
+        FragColor = vec4(max(glow, paddle));
+    }
+
+    )";
+
+    return Graphics::CreateShaderFromSource(gl::FragmentShader, kSource);
+}
+
+void DestroyRenderer(Renderer& renderer) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(renderer.program);
+
+    gl::DeleteProgram(renderer.program);
+    gl::DeleteVertexArrays(1, &renderer.vertexArray);
+
+    renderer = Renderer{};
+}
+
+void Render(const Renderer& renderer, const Match& match) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(renderer.IsValid());
+
+    const auto& kPaddle1 = match.paddle1;
+    const auto& kPaddle2 = match.paddle2;
+    const auto& kBall = match.ball;
+
+    const GLfloat kObjects[] =
+    {
+        kPaddle1.position.x, kPaddle1.position.y, kPaddle1.size.x / 2.0f, kPaddle1.size.y / 2.0f,
+        kPaddle2.position.x, kPaddle2.position.y, kPaddle2.size.x / 2.0f, kPaddle2.size.y / 2.0f,
+        kBall.position.x, kBall.position.y, kBall.radius, 0.0f
+    };
+
+    gl::UseProgram(renderer.program);
+    gl::Uniform4fv(renderer.objectsLocation, 3, kObjects);
+
+    gl::BindVertexArray(renderer.vertexArray);
+    gl::DrawArrays(gl::Triangles, 0, 3);
+}
+
+} // namespace lepong::SdfRenderer
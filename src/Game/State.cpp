@@ -0,0 +1,159 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cstddef> // For offsetof.
+#include <cstdio>
+#include <cstring>
+
+#include "lepong/Check.h"
+#include "lepong/Game/State.h"
+
+namespace lepong
+{
+
+// The hash works on independent lanes so the compiler can keep them in vector registers.
+// The constants are the xxHash64 primes.
+
+static constexpr std::uint64_t skPrime1 = 0x9E3779B185EBCA87ull;
+static constexpr std::uint64_t skPrime2 = 0xC2B2AE3D27D4EB4Full;
+static constexpr std::uint64_t skPrime3 = 0x165667B19E3779F9ull;
+
+static constexpr std::size_t skNumLanes = 4;
+static constexpr std::size_t skNumWords = sizeof(State) / sizeof(std::uint64_t);
+
+///
+/// Rotates the provided value left.
+///
+LEPONG_NODISCARD static constexpr std::uint64_t RotateLeft(std::uint64_t value, unsigned amount) noexcept
+{
+    return (value << amount) | (value >> (64u - amount));
+}
+
+///
+/// Mixes a word into a lane.
+///
+LEPONG_NODISCARD static constexpr std::uint64_t MixLane(std::uint64_t lane, std::uint64_t word) noexcept
+{
+    return RotateLeft(lane + word * skPrime2, 31u) * skPrime1;
+}
+
+std::uint64_t HashState(const State& state) noexcept
+{
+    std::uint64_t words[skNumWords];
+    std::memcpy(words, &state, sizeof(State));
+
+    std::uint64_t lanes[skNumLanes] = { skPrime1, skPrime2, skPrime3, skPrime1 ^ skPrime2 };
+
+    for (std::size_t i = 0; i < skNumWords; ++i)
+    {
+        lanes[i % skNumLanes] = MixLane(lanes[i % skNumLanes], words[i]);
+    }
+
+    auto hash =
+        RotateLeft(lanes[0], 1u) + RotateLeft(lanes[1], 7u) +
+        RotateLeft(lanes[2], 12u) + RotateLeft(lanes[3], 18u);
+
+    // Final avalanche.
+    hash ^= hash >> 33u;
+    hash *= skPrime2;
+    hash ^= hash >> 29u;
+    hash *= skPrime3;
+    hash ^= hash >> 32u;
+
+    return hash;
+}
+
+///
+/// Describes a 32 bit field of the state.
+///
+struct StateField
+{
+    const char* name;
+    std::size_t offset;
+    bool isFloat;
+};
+
+#define LEPONG_STATE_FIELD(member, isFloat) \
+    StateField{ #member, offsetof(State, member), isFloat }
+
+#define LEPONG_STATE_VECTOR_FIELDS(member) \
+    StateField{ #member ".x", offsetof(State, member), true }, \
+    StateField{ #member ".y", offsetof(State, member) + sizeof(float), true }
+
+static constexpr StateField skStateFields[] =
+{
+    LEPONG_STATE_VECTOR_FIELDS(ballPosition),
+    LEPONG_STATE_VECTOR_FIELDS(ballMoveDirection),
+    LEPONG_STATE_FIELD(ballMoveSpeed, true),
+    LEPONG_STATE_VECTOR_FIELDS(paddle1Position),
+    LEPONG_STATE_FIELD(paddle1MoveDirectionY, true),
+    LEPONG_STATE_FIELD(paddle1MoveSpeed, true),
+    LEPONG_STATE_VECTOR_FIELDS(paddle2Position),
+    LEPONG_STATE_FIELD(paddle2MoveDirectionY, true),
+    LEPONG_STATE_FIELD(paddle2MoveSpeed, true),
+    LEPONG_STATE_FIELD(playerScores[0], false),
+    LEPONG_STATE_FIELD(playerScores[1], false),
+    LEPONG_STATE_FIELD(playing, false),
+    LEPONG_STATE_FIELD(randomState, false)
+};
+
+#undef LEPONG_STATE_VECTOR_FIELDS
+#undef LEPONG_STATE_FIELD
+
+///
+/// Logs a single differing field.
+///
+static void LogFieldDifference(const StateField& field, std::uint32_t expected, std::uint32_t actual) noexcept;
+
+bool CheckStatesMatch(std::uint64_t tick, const State& expected, const State& actual) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(std::memcmp(&expected, &actual, sizeof(State)) != 0, true);
+
+    char message[64];
+    std::snprintf(message, sizeof(message), "State mismatch at tick %llu:", static_cast<unsigned long long>(tick));
+    Log::Log(message);
+
+    const auto kExpectedBytes = reinterpret_cast<const unsigned char*>(&expected);
+    const auto kActualBytes = reinterpret_cast<const unsigned char*>(&actual);
+
+    for (const auto& kField : skStateFields)
+    {
+        std::uint32_t expectedValue;
+        std::uint32_t actualValue;
+
+        std::memcpy(&expectedValue, kExpectedBytes + kField.offset, sizeof(std::uint32_t));
+        std::memcpy(&actualValue, kActualBytes + kField.offset, sizeof(std::uint32_t));
+
+        if (expectedValue != actualValue)
+        {
+            LogFieldDifference(kField, expectedValue, actualValue);
+        }
+    }
+
+    return false;
+}
+
+void LogFieldDifference(const StateField& field, std::uint32_t expected, std::uint32_t actual) noexcept
+{
+    char message[128];
+
+    if (field.isFloat)
+    {
+        float expectedFloat;
+        float actualFloat;
+
+        std::memcpy(&expectedFloat, &expected, sizeof(float));
+        std::memcpy(&actualFloat, &actual, sizeof(float));
+
+        std::snprintf(message, sizeof(message), "    %s: expected %.9g, got %.9g", field.name, expectedFloat, actualFloat);
+    }
+    else
+    {
+        std::snprintf(message, sizeof(message), "    %s: expected %u, got %u", field.name, expected, actual);
+    }
+
+    Log::Log(message);
+}
+
+} // namespace lepong
@@ -0,0 +1,512 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+#include <Windows.h>
+
+#include "lepong/Check.h"
+#include "lepong/Graphics/Bloom.h"
+#include "lepong/Graphics/FrameUniforms.h"
+#include "lepong/Graphics/Quad.h"
+
+namespace lepong::Bloom
+{
+
+// Only the part of the emitters above this value glows.
+static constexpr float skThreshold = 0.5f;
+
+// Scales the glow written to the frame. The upsampled levels add up the glow of every level below them.
+static constexpr float skIntensity = 1.0f;
+
+static_assert(skNumLevels >= 3u, "The composite reads the first upsampled level");
+
+static constexpr GLuint skRegionLayout[] = { 4 };
+
+bool IsSelected() noexcept
+{
+    char value[4] = {};
+    GetEnvironmentVariableA(skSelectionVariable, value, sizeof(value));
+
+    return value[0] == '1' && value[1] == '\0';
+}
+
+///
+/// Creates the programs used by the passes.
+///
+/// \return Whether every program was created.
+///
+LEPONG_NODISCARD static bool MakePrograms(Effect& effect) noexcept;
+
+///
+/// Creates a target for each level, each one half the size of the previous one, then the blur and upsampled targets.
+///
+/// \return Whether every target is complete.
+///
+LEPONG_NODISCARD static bool MakeTargets(Effect& effect) noexcept;
+
+///
+/// Creates the quad and buffer used to draw the regions.
+///
+/// \return Whether the resources were created.
+///
+LEPONG_NODISCARD static bool MakeRegionResources(Effect& effect) noexcept;
+
+Effect MakeEffect(const Vector2i& winSize) noexcept
+{
+    Effect effect;
+    effect.winSize = winSize;
+    effect.targetSize = winSize;
+
+    // The programs are given the sizes of the targets.
+    const auto kCreated =
+        MakeTargets(effect) &&
+        MakePrograms(effect) &&
+        MakeRegionResources(effect);
+
+    if (!kCreated)
+    {
+        DestroyEffect(effect);
+    }
+
+    return effect;
+}
+
+///
+/// Creates a vertex shader that outputs one region per instance, with texture coordinates.<br>
+/// Regions are in window pixels, the viewport maps them to the level being drawn.
+///
+LEPONG_NODISCARD static GLuint MakeRegionVertexShader() noexcept;
+
+///
+/// Creates a fragment shader that averages a 4×4 footprint of the source with 4 bilinear taps, and keeps only the
+/// part above the threshold.
+///
+LEPONG_NODISCARD static GLuint MakeDownsampleFragmentShader() noexcept;
+
+///
+/// Creates a fragment shader that applies the 5 tap Gaussian [1 4 6 4 1] kernel along one axis, in 3 bilinear taps.
+///
+LEPONG_NODISCARD static GLuint MakeBlurFragmentShader() noexcept;
+
+///
+/// Creates a fragment shader that magnifies the level below with a 3×3 tent filter, the separable [1 2 1] kernel in 4
+/// bilinear taps, and adds the level's own glow.
+///
+LEPONG_NODISCARD static GLuint MakeUpsampleFragmentShader() noexcept;
+
+///
+/// Creates a fragment shader that outputs the glow, the first upsampled level magnified with the same tent filter.
+///
+LEPONG_NODISCARD static GLuint MakeCompositeFragmentShader() noexcept;
+
+///
+/// Creates a program using the provided shaders, then destroys them.
+///
+LEPONG_NODISCARD static GLuint CreateProgram(GLuint vertex, GLuint fragment) noexcept;
+
+bool MakePrograms(Effect& effect) noexcept
+{
+    effect.downsampleProgram = CreateProgram(MakeRegionVertexShader(), MakeDownsampleFragmentShader());
+    effect.blurProgram = CreateProgram(MakeRegionVertexShader(), MakeBlurFragmentShader());
+    effect.upsampleProgram = CreateProgram(MakeRegionVertexShader(), MakeUpsampleFragmentShader());
+    effect.compositeProgram = CreateProgram(MakeRegionVertexShader(), MakeCompositeFragmentShader());
+
+    LEPONG_CHECK_OR_RETURN_VAL(
+        effect.downsampleProgram && effect.blurProgram && effect.upsampleProgram && effect.compositeProgram, false);
+
+    effect.downsampleTexelSizeLocation = gl::GetUniformLocation(effect.downsampleProgram, "uTexelSize");
+    effect.downsampleThresholdLocation = gl::GetUniformLocation(effect.downsampleProgram, "uThreshold");
+    effect.blurStepLocation = gl::GetUniformLocation(effect.blurProgram, "uStep");
+    effect.upsampleTexelSizeLocation = gl::GetUniformLocation(effect.upsampleProgram, "uTexelSize");
+
+    // The level below is read from the first unit, the level's own glow from the second.
+    gl::UseProgram(effect.upsampleProgram);
+    gl::Uniform1i(gl::GetUniformLocation(effect.upsampleProgram, "uLower"), 0);
+    gl::Uniform1i(gl::GetUniformLocation(effect.upsampleProgram, "uLevel"), 1);
+
+    // The levels are sized once, so is the composite's texel.
+    const auto& kFirstUpsampledSize = effect.levelSizes[1];
+
+    gl::UseProgram(effect.compositeProgram);
+    gl::Uniform1f(gl::GetUniformLocation(effect.compositeProgram, "uIntensity"), skIntensity);
+
+    gl::Uniform2f(
+        gl::GetUniformLocation(effect.compositeProgram, "uTexelSize"),
+        1.0f / static_cast<float>(kFirstUpsampledSize.x), 1.0f / static_cast<float>(kFirstUpsampledSize.y));
+
+    return true;
+}
+
+GLuint CreateProgram(GLuint vertex, GLuint fragment) noexcept
+{
+    const auto kProgram = Graphics::CreateProgramFromShaders(vertex, fragment);
+
+    gl::DeleteShader(vertex);
+    gl::DeleteShader(fragment);
+
+    return kProgram;
+}
+
+GLuint MakeRegionVertexShader() noexcept
+{
+    constexpr auto kSource =
+    R"(
+
+    #version 330 core
+
+    )" LEPONG_GLSL_FRAME_BLOCK R"(
+
+    layout (location = 0) in vec2 aPosition;
+
+    // The region's center and size.
+    layout (location = 2) in vec4 aInstance;
+
+    out vec2 vTextureCoords;
+
+    void main()
+    {
+        gl_Position = uProjection * vec4(aPosition * aInstance.zw + aInstance.xy, 0.0, 1.0);
+
+        // The targets cover the whole window.
+        vTextureCoords = gl_Position.xy * 0.5 + vec2(0.5);
+    }
+
+    )";
+
+    return Graphics::CreateShaderFromSource(gl::VertexShader, kSource);
+}
+
+GLuint MakeDownsampleFragmentShader() noexcept
+{
+    constexpr auto kSource =
+    R"(
+
+    #version 330 core
+
+    in vec2 vTextureCoords;
+
+    uniform sampler2D uSource;
+
+    // The size of a source texel in texture coordinates.
+    uniform vec2 uTexelSize;
+
+    uniform float uThreshold;
+
+    out vec4 FragColor;
+
+    void main()
+    {
+        // Each tap sits between four texels, the filter does the averaging.
+        float value =
+            texture(uSource, vTextureCoords + uTexelSize * vec2(-1.0, -1.0)).r +
+            texture(uSource, vTextureCoords + uTexelSize * vec2( 1.0, -1.0)).r +
+            texture(uSource, vTextureCoords + uTexelSize * vec2(-1.0,  1.0)).r +
+            texture(uSource, vTextureCoords + uTexelSize * vec2( 1.0,  1.0)).r;
+
+        value = max(value * 0.25 - uThreshold, 0.0) / (1.0 - uThreshold);
+
+        FragColor = vec4(value, 0.0, 0.0, 1.0);
+    }
+
+    )";
+
+    return Graphics::CreateShaderFromSource(gl::FragmentShader, kSource);
+}
+
+GLuint MakeBlurFragmentShader() noexcept
+{
+    constexpr auto kSource =
+    R"(
+
+    #version 330 core
+
+    in vec2 vTextureCoords;
+
+    uniform sampler2D uSource;
+
+    // A source texel along the blurred axis, in texture coordinates.
+    uniform vec2 uStep;
+
+    out vec4 FragColor;
+
+    void main()
+    {
+        // The outer taps sit between the 4 and 1 weighted texels, 1.2 texels away so that the filter splits them 4:1.
+        float value =
+            texture(uSource, vTextureCoords).r * 0.375 +
+            texture(uSource, vTextureCoords - uStep * 1.2).r * 0.3125 +
+            texture(uSource, vTextureCoords + uStep * 1.2).r * 0.3125;
+
+        FragColor = vec4(value, 0.0, 0.0, 1.0);
+    }
+
+    )";
+
+    return Graphics::CreateShaderFromSource(gl::FragmentShader, kSource);
+}
+
+GLuint MakeUpsampleFragmentShader() noexcept
+{
+    constexpr auto kSource =
+    R"(
+
+    #version 330 core
+
+    in vec2 vTextureCoords;
+
+    uniform sampler2D uLower;
+    uniform sampler2D uLevel;
+
+    // The size of a texel of the level below in texture coordinates.
+    uniform vec2 uTexelSize;
+
+    out vec4 FragColor;
+
+    void main()
+    {
+        float lower =
+            texture(uLower, vTextureCoords + uTexelSize * vec2(-0.5, -0.5)).r +
+            texture(uLower, vTextureCoords + uTexelSize * vec2( 0.5, -0.5)).r +
+            texture(uLower, vTextureCoords + uTexelSize * vec2(-0.5,  0.5)).r +
+            texture(uLower, vTextureCoords + uTexelSize * vec2( 0.5,  0.5)).r;
+
+        // The target is 8 bits per channel, the sum saturates instead of wrapping.
+        float value = min(lower * 0.25 + texture(uLevel, vTextureCoords).r, 1.0);
+
+        FragColor = vec4(value, 0.0, 0.0, 1.0);
+    }
+
+    )";
+
+    return Graphics::CreateShaderFromSource(gl::FragmentShader, kSource);
+}
+
+GLuint MakeCompositeFragmentShader() noexcept
+{
+    constexpr auto kSource =
+    R"(
+
+    #version 330 core
+
+    in vec2 vTextureCoords;
+
+    uniform sampler2D uBloom;
+    uniform float uIntensity;
+
+    // The size of a texel of the first upsampled level in texture coordinates.
+    uniform vec2 uTexelSize;
+
+    out vec4 FragColor;
+
+    void main()
+    {
+        // A tap half a texel away weighs both texels equally, 4 of them add up to the [1 2 1] kernel both ways.
+        float value =
+            texture(uBloom, vTextureCoords + uTexelSize * vec2(-0.5, -0.5)).r +
+            texture(uBloom, vTextureCoords + uTexelSize * vec2( 0.5, -0.5)).r +
+            texture(uBloom, vTextureCoords + uTexelSize * vec2(-0.5,  0.5)).r +
+            texture(uBloom, vTextureCoords + uTexelSize * vec2( 0.5,  0.5)).r;
+
+        FragColor = vec4(value * 0.25 * uIntensity);
+    }
+
+    )";
+
+    return Graphics::CreateShaderFromSource(gl::FragmentShader, kSource);
+}
+
+bool MakeTargets(Effect& effect) noexcept
+{
+    // The emitters are drawn at half the window's resolution, the glow doesn't need more.
+    auto levelSize = Vector2i{ std::max(effect.winSize.x / 2, 1), std::max(effect.winSize.y / 2, 1) };
+
+    for (auto& size : effect.levelSizes)
+    {
+        size = levelSize;
+        levelSize = { std::max(levelSize.x / 2, 1), std::max(levelSize.y / 2, 1) };
+    }
+
+    auto complete = true;
+
+    for (auto i = 0u; complete && i < skNumLevels; ++i)
+    {
+        complete = Graphics::MakeRenderTarget(effect.textures[i], effect.framebuffers[i], effect.levelSizes[i]);
+    }
+
+    complete = complete && Graphics::MakeRenderTarget(
+        effect.blurTexture, effect.blurFramebuffer, effect.levelSizes[skNumLevels - 1u]);
+
+    for (auto i = 0u; complete && i < skNumLevels - 2u; ++i)
+    {
+        complete = Graphics::MakeRenderTarget(
+            effect.upsampledTextures[i], effect.upsampledFramebuffers[i], effect.levelSizes[i + 1u]);
+    }
+
+    gl::BindFramebuffer(gl::Framebuffer, 0);
+    gl::BindTexture(gl::Texture2D, 0);
+
+    return complete;
+}
+
+bool MakeRegionResources(Effect& effect) noexcept
+{
+    effect.quad = Graphics::MakeSimpleQuad();
+    gl::GenBuffers(1, &effect.regionBuffer);
+
+    LEPONG_CHECK_OR_RETURN_VAL(effect.quad.IsValid() && effect.regionBuffer, false);
+
+    gl::BindBuffer(gl::ArrayBuffer, effect.regionBuffer);
+    gl::BufferData(gl::ArrayBuffer, skMaxRegions * 4u * sizeof(GLfloat), nullptr, gl::StreamDraw);
+
+    Graphics::SetMeshInstanceLayout(effect.quad, effect.regionBuffer, 0, Graphics::skQuadInstanceAttribute, skRegionLayout);
+    return true;
+}
+
+void DestroyEffect(Effect& effect) noexcept
+{
+    gl::DeleteBuffers(1, &effect.regionBuffer);
+    Graphics::DestroyMesh(effect.quad);
+
+    gl::DeleteFramebuffers(skNumLevels - 2u, effect.upsampledFramebuffers);
+    gl::DeleteTextures(skNumLevels - 2u, effect.upsampledTextures);
+
+    gl::DeleteFramebuffers(1, &effect.blurFramebuffer);
+    gl::DeleteTextures(1, &effect.blurTexture);
+
+    gl::DeleteFramebuffers(skNumLevels, effect.framebuffers);
+    gl::DeleteTextures(skNumLevels, effect.textures);
+
+    gl::DeleteProgram(effect.compositeProgram);
+    gl::DeleteProgram(effect.upsampleProgram);
+    gl::DeleteProgram(effect.blurProgram);
+    gl::DeleteProgram(effect.downsampleProgram);
+
+    effect = Effect{};
+}
+
+void SetTarget(Effect& effect, GLuint framebuffer, const Vector2i& size) noexcept
+{
+    effect.targetFramebuffer = framebuffer;
+    effect.targetSize = size;
+}
+
+void BeginEmitters(const Effect& effect) noexcept
+{
+    const auto& kSize = effect.levelSizes[0];
+
+    gl::BindFramebuffer(gl::Framebuffer, effect.framebuffers[0]);
+    gl::Viewport(0, 0, kSize.x, kSize.y);
+
+    gl::Clear(gl::ColorBufferBit);
+}
+
+void EndEmitters(const Effect& effect) noexcept
+{
+    gl::BindFramebuffer(gl::Framebuffer, effect.targetFramebuffer);
+    gl::Viewport(0, 0, effect.targetSize.x, effect.targetSize.y);
+}
+
+///
+/// Sets the provided uniform to one texel of a texture of the provided size, along the provided axes.
+///
+static void SetTexelSize(GLint location, const Vector2i& size, float x = 1.0f, float y = 1.0f) noexcept;
+
+///
+/// Clears the provided target, then draws the regions into it from the provided source texture.
+///
+static void DrawPass(
+    const Effect& effect, GLsizei numRegions, GLuint source, GLuint target, const Vector2i& targetSize) noexcept;
+
+void Apply(const Effect& effect, const GLfloat* regions, unsigned numRegions) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(effect.IsValid());
+
+    // Every pass only covers the regions around the emitters, the rest of each level stays cleared.
+    numRegions = std::min(numRegions, skMaxRegions);
+    GLfloat expandedRegions[skMaxRegions * 4u];
+
+    for (auto i = 0u; i < numRegions * 4u; i += 4u)
+    {
+        expandedRegions[i + 0u] = regions[i + 0u];
+        expandedRegions[i + 1u] = regions[i + 1u];
+        expandedRegions[i + 2u] = regions[i + 2u] + skRadius * 2.0f;
+        expandedRegions[i + 3u] = regions[i + 3u] + skRadius * 2.0f;
+    }
+
+    gl::BindBuffer(gl::ArrayBuffer, effect.regionBuffer);
+    gl::BufferSubData(gl::ArrayBuffer, 0, numRegions * 4u * sizeof(GLfloat), expandedRegions);
+
+    const auto kNumRegions = static_cast<GLsizei>(numRegions);
+
+    // Down the chain, the threshold is only applied once.
+    gl::UseProgram(effect.downsampleProgram);
+    gl::Uniform1f(effect.downsampleThresholdLocation, skThreshold);
+
+    for (auto i = 1u; i < skNumLevels; ++i)
+    {
+        SetTexelSize(effect.downsampleTexelSizeLocation, effect.levelSizes[i - 1u]);
+        DrawPass(effect, kNumRegions, effect.textures[i - 1u], effect.framebuffers[i], effect.levelSizes[i]);
+
+        gl::Uniform1f(effect.downsampleThresholdLocation, 0.0f);
+    }
+
+    // The last level is blurred horizontally into the blur target, then vertically back.
+    constexpr auto kLastLevel = skNumLevels - 1u;
+    const auto& kLastLevelSize = effect.levelSizes[kLastLevel];
+
+    gl::UseProgram(effect.blurProgram);
+
+    SetTexelSize(effect.blurStepLocation, kLastLevelSize, 1.0f, 0.0f);
+    DrawPass(effect, kNumRegions, effect.textures[kLastLevel], effect.blurFramebuffer, kLastLevelSize);
+
+    SetTexelSize(effect.blurStepLocation, kLastLevelSize, 0.0f, 1.0f);
+    DrawPass(effect, kNumRegions, effect.blurTexture, effect.framebuffers[kLastLevel], kLastLevelSize);
+
+    // Up the chain, each upsampled level reads the one below and adds its own downsampled glow.
+    gl::UseProgram(effect.upsampleProgram);
+
+    for (auto i = kLastLevel - 1u; i >= 1u; --i)
+    {
+        const auto kLower = i + 1u == kLastLevel ? effect.textures[kLastLevel] : effect.upsampledTextures[i];
+
+        gl::ActiveTexture(gl::Texture0 + 1u);
+        gl::BindTexture(gl::Texture2D, effect.textures[i]);
+        gl::ActiveTexture(gl::Texture0);
+
+        SetTexelSize(effect.upsampleTexelSizeLocation, effect.levelSizes[i + 1u]);
+        DrawPass(effect, kNumRegions, kLower, effect.upsampledFramebuffers[i - 1u], effect.levelSizes[i]);
+    }
+
+    gl::ActiveTexture(gl::Texture0 + 1u);
+    gl::BindTexture(gl::Texture2D, 0);
+    gl::ActiveTexture(gl::Texture0);
+
+    EndEmitters(effect);
+
+    // The first upsampled level is magnified straight into the target. Overlapping regions write the same values.
+    gl::UseProgram(effect.compositeProgram);
+    gl::BindTexture(gl::Texture2D, effect.upsampledTextures[0]);
+
+    Graphics::DrawMeshInstanced(effect.quad, kNumRegions);
+
+    gl::BindTexture(gl::Texture2D, 0);
+}
+
+void SetTexelSize(GLint location, const Vector2i& size, float x, float y) noexcept
+{
+    gl::Uniform2f(location, x / static_cast<float>(size.x), y / static_cast<float>(size.y));
+}
+
+void DrawPass(
+    const Effect& effect, GLsizei numRegions, GLuint source, GLuint target, const Vector2i& targetSize) noexcept
+{
+    gl::BindFramebuffer(gl::Framebuffer, target);
+    gl::Viewport(0, 0, targetSize.x, targetSize.y);
+    gl::Clear(gl::ColorBufferBit);
+
+    gl::BindTexture(gl::Texture2D, source);
+    Graphics::DrawMeshInstanced(effect.quad, numRegions);
+}
+
+} // namespace lepong::Bloom
@@ -0,0 +1,279 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <Windows.h>
+
+#include "lepong/Check.h"
+#include "lepong/Graphics/DynamicResolution.h"
+#include "lepong/Graphics/GpuTimer.h"
+
+namespace lepong::Graphics::DynamicResolution
+{
+
+std::uint64_t GetSelectedBudget() noexcept
+{
+    char value[16] = {};
+    GetEnvironmentVariableA(skSelectionVariable, value, sizeof(value));
+
+    const auto kMilliseconds = std::strtod(value, nullptr);
+    return kMilliseconds > 0.0 ? static_cast<std::uint64_t>(kMilliseconds * 1e6) : 0u;
+}
+
+///
+/// Creates the program that draws the target over the window.
+///
+/// \return Whether the program was created.
+///
+LEPONG_NODISCARD static bool MakeUpscaleProgram(Scaler& scaler) noexcept;
+
+Scaler MakeScaler(const Vector2i& winSize, std::uint64_t budget) noexcept
+{
+    Scaler scaler;
+    scaler.winSize = winSize;
+    scaler.renderSize = winSize;
+    scaler.budget = budget;
+
+    const auto kComplete = MakeRenderTarget(scaler.texture, scaler.framebuffer, winSize);
+
+    gl::BindFramebuffer(gl::Framebuffer, 0);
+    gl::BindTexture(gl::Texture2D, 0);
+
+    gl::GenVertexArrays(1, &scaler.vertexArray);
+
+    if (!kComplete || !scaler.vertexArray || !MakeUpscaleProgram(scaler))
+    {
+        DestroyScaler(scaler);
+    }
+
+    return scaler;
+}
+
+///
+/// Creates a vertex shader that covers the window with a single triangle, with texture coordinates scaled to the
+/// rendered part of the target.
+///
+LEPONG_NODISCARD static GLuint MakeUpscaleVertexShader() noexcept;
+
+///
+/// Creates a fragment shader that samples the target without reading outside the rendered part.
+///
+LEPONG_NODISCARD static GLuint MakeUpscaleFragmentShader() noexcept;
+
+bool MakeUpscaleProgram(Scaler& scaler) noexcept
+{
+    const auto kVertex = MakeUpscaleVertexShader();
+    const auto kFragment = MakeUpscaleFragmentShader();
+
+    scaler.program = CreateProgramFromShaders(kVertex, kFragment);
+
+    gl::DeleteShader(kVertex);
+    gl::DeleteShader(kFragment);
+
+    LEPONG_CHECK_OR_RETURN_VAL(scaler.program, false);
+
+    scaler.scaleLocation = gl::GetUniformLocation(scaler.program, "uScale");
+    scaler.maxTextureCoordsLocation = gl::GetUniformLocation(scaler.program, "uMaxTextureCoords");
+
+    return true;
+}
+
+GLuint MakeUpscaleVertexShader() noexcept
+{
+    constexpr auto kSource =
+    R"(
+
+    #version 330 core
+
+    // The part of the target that was rendered to.
+    uniform vec2 uScale;
+
+    out vec2 vTextureCoords;
+
+    void main()
+    {
+        // (-1, -1), (3, -1) and (-1, 3), the window is the part of the triangle inside [-1, 1].
+        vec2 position = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2) * 2.0 - vec2(1.0);
+
+        vTextureCoords = (position * 0.5 + vec2(0.5)) * uScale;
+        gl_Position = vec4(position, 0.0, 1.0);
+    }
+
+    )";
+
+    return CreateShaderFromSource(gl::VertexShader, kSource);
+}
+
+GLuint MakeUpscaleFragmentShader() noexcept
+{
+    constexpr auto kSource =
+    R"(
+
+    #version 330 core
+
+    in vec2 vTextureCoords;
+
+    uniform sampler2D uScene;
+
+    // The center of the last rendered texel, filtering past it would blend in what was left from larger frames.
+    uniform vec2 uMaxTextureCoords;
+
+    out vec4 fColor;
+
+    void main()
+    {
+        fColor = texture(uScene, min(vTextureCoords, uMaxTextureCoords));
+    }
+
+    )";
+
+    return CreateShaderFromSource(gl::FragmentShader, kSource);
+}
+
+void DestroyScaler(Scaler& scaler) noexcept
+{
+    gl::DeleteProgram(scaler.program);
+    gl::DeleteVertexArrays(1, &scaler.vertexArray);
+
+    gl::DeleteFramebuffers(1, &scaler.framebuffer);
+    gl::DeleteTextures(1, &scaler.texture);
+
+    scaler = Scaler{};
+}
+
+///
+/// \return The size of the part of the target rendered to at the provided scale.
+///
+LEPONG_NODISCARD static Vector2i GetRenderSize(const Vector2i& winSize, float scale) noexcept;
+
+void Resize(Scaler& scaler, const Vector2i& winSize) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(scaler.IsValid());
+
+    gl::BindTexture(gl::Texture2D, scaler.texture);
+    gl::TexImage2D(gl::Texture2D, 0, gl::RGBA8, winSize.x, winSize.y, 0, gl::RGBA, gl::UnsignedByte, nullptr);
+    gl::BindTexture(gl::Texture2D, 0);
+
+    scaler.winSize = winSize;
+    scaler.renderSize = GetRenderSize(winSize, scaler.scale);
+
+    // The frame times measured at the previous size say nothing about the new one.
+    scaler.previousScale = scaler.scale;
+    scaler.numSamples = 0u;
+    scaler.framesUntilAdjust = GpuTimer::skLatency;
+}
+
+///
+/// Changes the resolution and remembers the current one, if the render size changes.
+///
+static void SetScale(Scaler& scaler, float scale) noexcept;
+
+void Update(Scaler& scaler, std::uint64_t frameTime) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(scaler.IsValid() && frameTime);
+
+    if (scaler.framesUntilRetry)
+    {
+        --scaler.framesUntilRetry;
+    }
+
+    // The frames measured right after a change were rendered at the previous resolution.
+    if (scaler.framesUntilAdjust)
+    {
+        --scaler.framesUntilAdjust;
+        return;
+    }
+
+    // Each new measurement counts for a quarter, a single slow frame doesn't change the resolution.
+    scaler.frameTime = scaler.numSamples ? (scaler.frameTime * 3u + frameTime) / 4u : frameTime;
+    ++scaler.numSamples;
+
+    LEPONG_CHECK_OR_RETURN(scaler.numSamples >= skNumSamples);
+
+    // Stretching the scene cost more than the pixels it saved.
+    if (scaler.scale < scaler.previousScale && scaler.frameTime >= scaler.previousFrameTime)
+    {
+        SetScale(scaler, scaler.previousScale);
+        scaler.framesUntilRetry = skRetryPeriod;
+
+        return;
+    }
+
+    const auto kFrameTime = static_cast<float>(scaler.frameTime);
+    const auto kBudget = static_cast<float>(scaler.budget);
+
+    const auto kOverBudget = kFrameTime > kBudget && !scaler.framesUntilRetry;
+    LEPONG_CHECK_OR_RETURN(kOverBudget || kFrameTime < kBudget * skHeadroom);
+
+    // The frame time is assumed to follow the number of pixels, the square of the scale. The new scale aims between
+    // the headroom and the budget.
+    const auto kTarget = kBudget * (1.0f + skHeadroom) / 2.0f;
+    const auto kScale = std::min(scaler.scale * std::sqrt(kTarget / kFrameTime), scaler.scale + skMaxScaleIncrease);
+
+    SetScale(scaler, std::clamp(kScale, skMinScale, 1.0f));
+}
+
+void SetScale(Scaler& scaler, float scale) noexcept
+{
+    const auto kRenderSize = GetRenderSize(scaler.winSize, scale);
+    LEPONG_CHECK_OR_RETURN(kRenderSize.x != scaler.renderSize.x || kRenderSize.y != scaler.renderSize.y);
+
+    scaler.previousScale = scaler.scale;
+    scaler.previousFrameTime = scaler.frameTime;
+
+    scaler.scale = scale;
+    scaler.renderSize = kRenderSize;
+
+    scaler.numSamples = 0u;
+    scaler.framesUntilAdjust = GpuTimer::skLatency;
+}
+
+Vector2i GetRenderSize(const Vector2i& winSize, float scale) noexcept
+{
+    const auto kRound = [scale](int size)
+    {
+        const auto kScaled = std::lround(static_cast<float>(size) * scale / skSizeGranularity) * skSizeGranularity;
+        return std::clamp(static_cast<int>(kScaled), std::min(skSizeGranularity, size), size);
+    };
+
+    return { kRound(winSize.x), kRound(winSize.y) };
+}
+
+void BeginScene(const Scaler& scaler) noexcept
+{
+    gl::BindFramebuffer(gl::Framebuffer, scaler.GetTargetFramebuffer());
+    gl::Viewport(0, 0, scaler.renderSize.x, scaler.renderSize.y);
+}
+
+void EndScene(const Scaler& scaler) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(scaler.IsScaled());
+
+    const auto& kSize = scaler.renderSize;
+    const auto& kWinSize = scaler.winSize;
+
+    gl::BindFramebuffer(gl::Framebuffer, 0);
+    gl::Viewport(0, 0, kWinSize.x, kWinSize.y);
+
+    const auto kWinSizeX = static_cast<float>(kWinSize.x);
+    const auto kWinSizeY = static_cast<float>(kWinSize.y);
+
+    // Drawn rather than blitted: a linear blit may filter past the rendered corner, the shader clamps to it.
+    gl::UseProgram(scaler.program);
+    gl::Uniform2f(scaler.scaleLocation, static_cast<float>(kSize.x) / kWinSizeX, static_cast<float>(kSize.y) / kWinSizeY);
+
+    gl::Uniform2f(
+        scaler.maxTextureCoordsLocation,
+        (static_cast<float>(kSize.x) - 0.5f) / kWinSizeX, (static_cast<float>(kSize.y) - 0.5f) / kWinSizeY);
+
+    gl::BindTexture(gl::Texture2D, scaler.texture);
+    gl::BindVertexArray(scaler.vertexArray);
+    gl::DrawArrays(gl::Triangles, 0, 3);
+
+    gl::BindTexture(gl::Texture2D, 0);
+}
+
+} // namespace lepong::Graphics::DynamicResolution
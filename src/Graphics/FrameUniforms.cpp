@@ -0,0 +1,82 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+
+#include "lepong/Check.h"
+#include "lepong/Graphics/FrameUniforms.h"
+
+namespace lepong::Graphics::FrameUniforms
+{
+
+static GLuint sBuffer = 0;
+
+static Vector2i sWorldSize;
+static Block sBlock;
+
+bool Init(const Vector2i& worldSize, const Vector2i& winSize) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(!sBuffer, false);
+
+    gl::GenBuffers(1, &sBuffer);
+    LEPONG_CHECK_OR_RETURN_VAL(sBuffer, false);
+
+    gl::BindBuffer(gl::UniformBuffer, sBuffer);
+    gl::BufferData(gl::UniformBuffer, sizeof(Block), nullptr, gl::StreamDraw);
+
+    // Nothing else is bound to the binding point, it only needs to be bound once.
+    gl::BindBufferBase(gl::UniformBuffer, skBinding, sBuffer);
+
+    sWorldSize = worldSize;
+    sBlock = Block{};
+
+    Resize(winSize);
+    return true;
+}
+
+void Cleanup() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sBuffer);
+
+    gl::DeleteBuffers(1, &sBuffer);
+    sBuffer = 0;
+}
+
+void Resize(const Vector2i& winSize) noexcept
+{
+    const auto kWinSizeX = static_cast<float>(std::max(winSize.x, 1));
+    const auto kWinSizeY = static_cast<float>(std::max(winSize.y, 1));
+
+    const auto kWorldSizeX = static_cast<float>(sWorldSize.x);
+    const auto kWorldSizeY = static_cast<float>(sWorldSize.y);
+
+    // The window's pixels per world unit, the world is centered along the other dimension.
+    const auto kScale = std::min(kWinSizeX / kWorldSizeX, kWinSizeY / kWorldSizeY);
+
+    auto& projection = sBlock.projection;
+    std::fill(std::begin(projection), std::end(projection), 0.0f);
+
+    // Column major.
+    projection[0] = 2.0f * kScale / kWinSizeX;
+    projection[5] = 2.0f * kScale / kWinSizeY;
+    projection[10] = 1.0f;
+    projection[12] = -kWorldSizeX * kScale / kWinSizeX;
+    projection[13] = -kWorldSizeY * kScale / kWinSizeY;
+    projection[15] = 1.0f;
+
+    sBlock.winSize[0] = kWinSizeX;
+    sBlock.winSize[1] = kWinSizeY;
+}
+
+void Update(float time) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sBuffer);
+
+    sBlock.time = time;
+
+    gl::BindBuffer(gl::UniformBuffer, sBuffer);
+    gl::BufferSubData(gl::UniformBuffer, 0, sizeof(Block), &sBlock);
+}
+
+} // namespace lepong::Graphics::FrameUniforms
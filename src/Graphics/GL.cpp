@@ -2,9 +2,12 @@
 // Created by lepouki on 10/15/2020.
 //
 
+#include <cstdio>
+
 #include "lepong/Check.h"
 #include "lepong/Window.h"
 #include "lepong/Graphics/GL.h"
+#include "lepong/Graphics/Trace.h"
 
 #include "WGLExtensions.h"
 #include "LoadOpenGLFunction.h"
@@ -20,9 +23,9 @@ static bool sInitialized = false;
 LEPONG_NODISCARD static Context MakeDummyContext() noexcept;
 
 ///
-/// Load all the OpenGL functions required by the graphics system.
+/// Load the WGL functions required to create the contexts.
 ///
-/// \return Whether all the required OpenGL functions were successfully loaded.
+/// \return Whether all the required WGL functions were successfully loaded.
 ///
 LEPONG_NODISCARD static bool LoadRequiredOpenGLFunctions() noexcept;
 
@@ -91,70 +94,22 @@ void SetDummyPixelFormat(HDC device) noexcept
     SetPixelFormat(device, kFormatIndex, nullptr);
 }
 
-// OpenGL functions.
+// WGL extensions. They create the contexts, so they are loaded once from a dummy context and shared by all of them.
 
-#define LEPONG_DECL_OPENGL_FUNCTION(name) \
+#define LEPONG_DECL_WGL_FUNCTION(name) \
     static PFN##name name = nullptr
 
-#define LEPONG_LOAD_OPENGL_FUNCTION(name) \
+#define LEPONG_LOAD_WGL_FUNCTION(name) \
     (name = reinterpret_cast<PFN##name>(LoadOpenGLFunction(#name)))
 
-LEPONG_DECL_OPENGL_FUNCTION(wglChoosePixelFormatARB);
-LEPONG_DECL_OPENGL_FUNCTION(wglCreateContextAttribsARB);
-LEPONG_DECL_OPENGL_FUNCTION(glCreateShader);
-LEPONG_DECL_OPENGL_FUNCTION(glDeleteShader);
-LEPONG_DECL_OPENGL_FUNCTION(glShaderSource);
-LEPONG_DECL_OPENGL_FUNCTION(glCompileShader);
-LEPONG_DECL_OPENGL_FUNCTION(glGetShaderiv);
-LEPONG_DECL_OPENGL_FUNCTION(glGetShaderInfoLog);
-LEPONG_DECL_OPENGL_FUNCTION(glCreateProgram);
-LEPONG_DECL_OPENGL_FUNCTION(glDeleteProgram);
-LEPONG_DECL_OPENGL_FUNCTION(glAttachShader);
-LEPONG_DECL_OPENGL_FUNCTION(glLinkProgram);
-LEPONG_DECL_OPENGL_FUNCTION(glGetProgramiv);
-LEPONG_DECL_OPENGL_FUNCTION(glGetProgramInfoLog);
-LEPONG_DECL_OPENGL_FUNCTION(glUseProgram);
-LEPONG_DECL_OPENGL_FUNCTION(glGenVertexArrays);
-LEPONG_DECL_OPENGL_FUNCTION(glDeleteVertexArrays);
-LEPONG_DECL_OPENGL_FUNCTION(glBindVertexArray);
-LEPONG_DECL_OPENGL_FUNCTION(glGenBuffers);
-LEPONG_DECL_OPENGL_FUNCTION(glDeleteBuffers);
-LEPONG_DECL_OPENGL_FUNCTION(glBindBuffer);
-LEPONG_DECL_OPENGL_FUNCTION(glBufferData);
-LEPONG_DECL_OPENGL_FUNCTION(glEnableVertexAttribArray);
-LEPONG_DECL_OPENGL_FUNCTION(glVertexAttribPointer);
-LEPONG_DECL_OPENGL_FUNCTION(glGetUniformLocation);
-LEPONG_DECL_OPENGL_FUNCTION(glUniform2f);
+LEPONG_DECL_WGL_FUNCTION(wglChoosePixelFormatARB);
+LEPONG_DECL_WGL_FUNCTION(wglCreateContextAttribsARB);
 
 bool LoadRequiredOpenGLFunctions() noexcept
 {
     return
-        LEPONG_LOAD_OPENGL_FUNCTION(wglChoosePixelFormatARB) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(wglCreateContextAttribsARB) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glCreateShader) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glDeleteShader) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glShaderSource) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glCompileShader) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glGetShaderiv) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glGetShaderInfoLog) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glCreateProgram) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glDeleteProgram) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glAttachShader) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glLinkProgram) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glGetProgramiv) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glGetProgramInfoLog) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glUseProgram) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glGenVertexArrays) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glDeleteVertexArrays) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glBindVertexArray) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glGenBuffers) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glDeleteBuffers) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glBindBuffer) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glBufferData) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glEnableVertexAttribArray) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glVertexAttribPointer) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glGetUniformLocation) &&
-        LEPONG_LOAD_OPENGL_FUNCTION(glUniform2f);
+        LEPONG_LOAD_WGL_FUNCTION(wglChoosePixelFormatARB) &&
+        LEPONG_LOAD_WGL_FUNCTION(wglCreateContextAttribsARB);
 }
 
 void DestroyDummyContext(const Context& context) noexcept
@@ -176,16 +131,40 @@ void Cleanup() noexcept
 ///
 LEPONG_NODISCARD static HGLRC MakeAdvancedContext(HDC device) noexcept;
 
+///
+/// Loads every function of the OpenGL interface for the current context.<br>
+/// Every missing function is reported, not only the first one.
+///
+/// \return Whether all the functions were successfully loaded.
+///
+LEPONG_NODISCARD static bool LoadDispatch(Dispatch& dispatch) noexcept;
+
 Context MakeContext(HWND window) noexcept
 {
-    const auto kDC = GetDC(window);
+    Context context;
+    context.targetWindow = window;
+    context.device = GetDC(window);
+    context.context = MakeAdvancedContext(context.device);
 
-    return
+    LEPONG_CHECK_OR_RETURN_VAL(context.context, context);
+
+    // Function pointers are only valid for the context they were loaded with.
+    const auto kPreviousDevice = wglGetCurrentDC();
+    const auto kPreviousContext = wglGetCurrentContext();
+
+    wglMakeCurrent(context.device, context.context);
+    const auto kLoaded = LoadDispatch(context.dispatch);
+    wglMakeCurrent(kPreviousDevice, kPreviousContext);
+
+    if (!kLoaded)
     {
-        window,
-        kDC,
-        MakeAdvancedContext(kDC)
-    };
+        Log::Log("Failed to load OpenGL functions");
+
+        wglDeleteContext(context.context);
+        context.context = nullptr;
+    }
+
+    return context;
 }
 
 ///
@@ -228,157 +207,55 @@ void SetAdvancedPixelFormat(HDC device) noexcept
     SetPixelFormat(device, formatIndex, nullptr);
 }
 
-void MakeContextCurrent(const Context& context) noexcept
-{
-    wglMakeCurrent(context.device, context.context);
-}
-
-void SwapBuffers(const Context& context) noexcept
-{
-    wglSwapLayerBuffers(context.device, WGL_SWAP_MAIN_PLANE);
-}
-
-void DestroyContext(const Context& context) noexcept
-{
-    wglDeleteContext(context.context);
-}
-
-// OpenGL interface.
-
-const GLubyte* GetString(GLenum name) noexcept
-{
-    return glGetString(name);
-}
-
-GLuint CreateShader(GLenum shaderType) noexcept
-{
-    return glCreateShader(shaderType);
-}
-
-void DeleteShader(GLuint shader) noexcept
-{
-    glDeleteShader(shader);
-}
-
-void ShaderSource(GLuint shader, GLsizei count, const GLchar** string, const GLint* length) noexcept
-{
-    glShaderSource(shader, count, string, length);
-}
-
-void CompileShader(GLuint shader) noexcept
-{
-    glCompileShader(shader);
-}
-
-void GetShaderiv(GLuint shader, GLenum pname, GLint* params) noexcept
-{
-    glGetShaderiv(shader, pname, params);
-}
-
-void GetShaderInfoLog(GLuint shader, GLsizei maxLength, GLsizei* length, GLchar* infoLog) noexcept
-{
-    glGetShaderInfoLog(shader, maxLength, length, infoLog);
-}
-
-GLuint CreateProgram() noexcept
-{
-    return glCreateProgram();
-}
-
-void DeleteProgram(GLuint program) noexcept
-{
-    glDeleteProgram(program);
-}
-
-void AttachShader(GLuint program, GLuint shader) noexcept
-{
-    glAttachShader(program, shader);
-}
-
-void LinkProgram(GLuint program) noexcept
-{
-    glLinkProgram(program);
-}
-
-void GetProgramiv(GLuint program, GLenum pname, GLint* params) noexcept
-{
-    glGetProgramiv(program, pname, params);
-}
-
-void GetProgramInfoLog(GLuint program, GLsizei maxLength, GLsizei* length, GLchar* infoLog) noexcept
-{
-    glGetProgramInfoLog(program, maxLength, length, infoLog);
-}
-
-void UseProgram(GLuint program) noexcept
-{
-    glUseProgram(program);
-}
-
-void GenVertexArrays(GLsizei n, GLuint* arrays) noexcept
-{
-    glGenVertexArrays(n, arrays);
-}
-
-void DeleteVertexArrays(GLsizei n, const GLuint* arrays) noexcept
+///
+/// Loads an OpenGL function, logging its name if it is missing.
+///
+/// \return Whether the function was loaded.
+///
+template<typename T>
+static bool LoadFunction(T& function, const char* name) noexcept
 {
-    glDeleteVertexArrays(n, arrays);
-}
+    function = reinterpret_cast<T>(LoadOpenGLFunction(name));
 
-void BindVertexArray(GLuint array) noexcept
-{
-    glBindVertexArray(array);
-}
+    if (!function)
+    {
+        char message[128];
+        std::snprintf(message, sizeof(message), "Missing OpenGL function %s", name);
 
-void GenBuffers(GLsizei n, GLuint* buffers) noexcept
-{
-    glGenBuffers(n, buffers);
-}
+        Log::Log(message);
+    }
 
-void DeleteBuffers(GLsizei n, const GLuint* buffers) noexcept
-{
-    glDeleteBuffers(n, buffers);
+    return function;
 }
 
-void BindBuffer(GLenum target, GLuint buffer) noexcept
+bool LoadDispatch(Dispatch& dispatch) noexcept
 {
-    glBindBuffer(target, buffer);
-}
+    auto loaded = true;
 
-void BufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) noexcept
-{
-    glBufferData(target, size, data, usage);
-}
+#define LEPONG_GL_LOAD_FUNCTION(returnType, name, parameters) \
+    loaded &= LoadFunction(dispatch.gl##name, "gl" #name);
 
-void EnableVertexAttribArray(GLuint index) noexcept
-{
-    glEnableVertexAttribArray(index);
-}
+    LEPONG_GL_FUNCTIONS(LEPONG_GL_LOAD_FUNCTION)
 
-void VertexAttribPointer(
-    GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer) noexcept
-{
-    glVertexAttribPointer(index, size, type, normalized, stride, pointer);
-}
+#undef LEPONG_GL_LOAD_FUNCTION
 
-void DrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices) noexcept
-{
-    glDrawElements(mode, count, type, indices);
+    return loaded;
 }
 
-void Clear(GLbitfield mask) noexcept
+void MakeContextCurrent(const Context& context) noexcept
 {
-    glClear(mask);
+    wglMakeCurrent(context.device, context.context);
+    tDispatch = context.dispatch;
 }
 
-GLint GetUniformLocation(GLuint program, const GLchar* name) noexcept
+void SwapBuffers(const Context& context) noexcept
 {
-    return glGetUniformLocation(program, name);
+    wglSwapLayerBuffers(context.device, WGL_SWAP_MAIN_PLANE);
 }
 
-void Uniform2f(GLint location, GLfloat v0, GLfloat v1) noexcept
+void DestroyContext(const Context& context) noexcept
 {
-    glUniform2f(location, v0, v1);
+    wglDeleteContext(context.context);
 }
 
 } // namespace lepong::Graphics::GL
@@ -0,0 +1,276 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cstdio>
+
+#include "lepong/Check.h"
+#include "lepong/Graphics/GL.h"
+
+#include "WindowX11.h"
+
+// "glxext.h" needs the types of "glext.h", which the interface declares itself.
+#define GLX_GLXEXT_LEGACY
+#include <GL/glx.h>
+
+namespace lepong::Graphics::GL
+{
+
+// The GLX implementation of the contexts, for the X11 windows. The context renders to the window's drawable, HGLRC is
+// the GLXContext.
+
+// Creates the contexts, the only GLX extension needed.
+using PFNglXCreateContextAttribsARB = GLXContext (*)(Display*, GLXFBConfig, GLXContext, Bool, const int*);
+
+static PFNglXCreateContextAttribsARB sCreateContextAttribs = nullptr;
+
+static constexpr int skContextMajorVersion = 0x2091; // GLX_CONTEXT_MAJOR_VERSION_ARB.
+static constexpr int skContextMinorVersion = 0x2092; // GLX_CONTEXT_MINOR_VERSION_ARB.
+
+///
+/// Loads a GLX or OpenGL function.
+///
+LEPONG_NODISCARD static void* LoadOpenGLFunction(const char* name) noexcept;
+
+bool Init() noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(!sCreateContextAttribs, false);
+
+    // Unlike WGL, GLX loads extensions without a context.
+    sCreateContextAttribs = reinterpret_cast<PFNglXCreateContextAttribsARB>(
+        LoadOpenGLFunction("glXCreateContextAttribsARB"));
+
+    LEPONG_CHECK_OR_LOG(sCreateContextAttribs, "Failed to load glXCreateContextAttribsARB");
+    return sCreateContextAttribs != nullptr;
+}
+
+void* LoadOpenGLFunction(const char* name) noexcept
+{
+    return reinterpret_cast<void*>(glXGetProcAddressARB(reinterpret_cast<const GLubyte*>(name)));
+}
+
+void Cleanup() noexcept
+{
+    sCreateContextAttribs = nullptr;
+}
+
+///
+/// Creates an OpenGL 3.3 context with a framebuffer configuration matching the window's visual.
+///
+LEPONG_NODISCARD static GLXContext MakeAdvancedContext(const HDC__& device) noexcept;
+
+///
+/// Loads every function of the OpenGL interface.<br>
+/// Every missing function is reported, not only the first one.
+///
+/// \return Whether all the functions were successfully loaded.
+///
+LEPONG_NODISCARD static bool LoadDispatch(Dispatch& dispatch) noexcept;
+
+Context MakeContext(HWND window) noexcept
+{
+    Context context;
+    LEPONG_CHECK_OR_RETURN_VAL(sCreateContextAttribs && window, context);
+
+    const auto kContext = MakeAdvancedContext(window->device);
+    LEPONG_CHECK_OR_RETURN_VAL(kContext, context);
+
+    // GLX function pointers don't depend on the context, they don't need it to be current.
+    if (!LoadDispatch(context.dispatch))
+    {
+        Log::Log("Failed to load OpenGL functions");
+
+        glXDestroyContext(window->device.display, kContext);
+        return context;
+    }
+
+    context.targetWindow = window;
+    context.device = &window->device;
+    context.context = reinterpret_cast<HGLRC>(kContext);
+
+    return context;
+}
+
+///
+/// \return The framebuffer configuration of the provided device's visual, nullptr if it doesn't support OpenGL.
+///
+LEPONG_NODISCARD static GLXFBConfig ChooseFramebufferConfig(const HDC__& device) noexcept;
+
+///
+/// \return The framebuffer configurations the contexts can be created with, best first, to be freed with XFree.
+///
+LEPONG_NODISCARD static GLXFBConfig* ChooseFramebufferConfigs(Display* display, int screen, int& numConfigs) noexcept;
+
+static bool sContextFailed = false;
+
+///
+/// Records that a request failed instead of exiting, the default X error handler's behavior.
+///
+static int OnContextError(Display*, XErrorEvent*) noexcept;
+
+GLXContext MakeAdvancedContext(const HDC__& device) noexcept
+{
+    const auto kConfig = ChooseFramebufferConfig(device);
+    LEPONG_CHECK_OR_LOG(kConfig, "No OpenGL framebuffer configuration matches the window");
+    LEPONG_CHECK_OR_RETURN_VAL(kConfig, nullptr);
+
+    constexpr int kAttributes[] =
+    {
+        skContextMajorVersion, 3,
+        skContextMinorVersion, 3,
+        None
+    };
+
+    // Unsupported versions are reported as X errors.
+    sContextFailed = false;
+    const auto kPreviousHandler = XSetErrorHandler(OnContextError);
+
+    auto context = sCreateContextAttribs(device.display, kConfig, nullptr, True, kAttributes);
+
+    XSync(device.display, False);
+    XSetErrorHandler(kPreviousHandler);
+
+    if (sContextFailed && context)
+    {
+        glXDestroyContext(device.display, context);
+        context = nullptr;
+    }
+
+    LEPONG_CHECK_OR_LOG(context, "Failed to create an OpenGL 3.3 context");
+    return context;
+}
+
+int OnContextError(Display*, XErrorEvent*) noexcept
+{
+    sContextFailed = true;
+    return 0;
+}
+
+GLXFBConfig ChooseFramebufferConfig(const HDC__& device) noexcept
+{
+    XWindowAttributes attributes = {};
+    XGetWindowAttributes(device.display, device.drawable, &attributes);
+
+    const auto kVisualId = XVisualIDFromVisual(attributes.visual);
+
+    int numConfigs = 0;
+    const auto kConfigs = ChooseFramebufferConfigs(device.display, XScreenNumberOfScreen(attributes.screen), numConfigs);
+
+    LEPONG_CHECK_OR_RETURN_VAL(kConfigs, nullptr);
+
+    // The window was created with the visual of one of them, see ChooseVisual.
+    GLXFBConfig config = nullptr;
+
+    for (int i = 0; i < numConfigs && !config; ++i)
+    {
+        int visualId = 0;
+        glXGetFBConfigAttrib(device.display, kConfigs[i], GLX_VISUAL_ID, &visualId);
+
+        if (static_cast<VisualID>(visualId) == kVisualId)
+        {
+            config = kConfigs[i];
+        }
+    }
+
+    XFree(kConfigs);
+    return config;
+}
+
+GLXFBConfig* ChooseFramebufferConfigs(Display* display, int screen, int& numConfigs) noexcept
+{
+    // Everything is drawn in 2D without depth or stencil tests, the default framebuffer has neither so that servers
+    // such as Xvfb, which only offer them with a few visuals, still have a match.
+    constexpr int kAttributes[] =
+    {
+        GLX_X_RENDERABLE, True,
+        GLX_DRAWABLE_TYPE, GLX_WINDOW_BIT,
+        GLX_RENDER_TYPE, GLX_RGBA_BIT,
+        GLX_X_VISUAL_TYPE, GLX_TRUE_COLOR,
+        GLX_DOUBLEBUFFER, True,
+        GLX_RED_SIZE, 8,
+        GLX_GREEN_SIZE, 8,
+        GLX_BLUE_SIZE, 8,
+        None
+    };
+
+    numConfigs = 0;
+    return glXChooseFBConfig(display, screen, kAttributes, &numConfigs);
+}
+
+XVisualInfo* ChooseVisual(Display* display, int screen) noexcept
+{
+    int numConfigs = 0;
+    const auto kConfigs = ChooseFramebufferConfigs(display, screen, numConfigs);
+
+    LEPONG_CHECK_OR_RETURN_VAL(kConfigs, nullptr);
+
+    XVisualInfo* visual = nullptr;
+
+    for (int i = 0; i < numConfigs && !visual; ++i)
+    {
+        visual = glXGetVisualFromFBConfig(display, kConfigs[i]);
+    }
+
+    XFree(kConfigs);
+    return visual;
+}
+
+///
+/// Loads an OpenGL function, logging its name if it is missing.
+///
+/// \return Whether the function was loaded.
+///
+template<typename T>
+static bool LoadFunction(T& function, const char* name) noexcept
+{
+    function = reinterpret_cast<T>(LoadOpenGLFunction(name));
+
+    if (!function)
+    {
+        char message[128];
+        std::snprintf(message, sizeof(message), "Missing OpenGL function %s", name);
+
+        Log::Log(message);
+    }
+
+    return function;
+}
+
+bool LoadDispatch(Dispatch& dispatch) noexcept
+{
+    auto loaded = true;
+
+#define LEPONG_GL_LOAD_FUNCTION(returnType, name, parameters) \
+    loaded &= LoadFunction(dispatch.gl##name, "gl" #name);
+
+    LEPONG_GL_FUNCTIONS(LEPONG_GL_LOAD_FUNCTION)
+
+#undef LEPONG_GL_LOAD_FUNCTION
+
+    return loaded;
+}
+
+void MakeContextCurrent(const Context& context) noexcept
+{
+    glXMakeCurrent(context.device->display, context.device->drawable, reinterpret_cast<GLXContext>(context.context));
+    tDispatch = context.dispatch;
+}
+
+void SwapBuffers(const Context& context) noexcept
+{
+    glXSwapBuffers(context.device->display, context.device->drawable);
+}
+
+void DestroyContext(const Context& context) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(context.context);
+
+    if (glXGetCurrentContext() == reinterpret_cast<GLXContext>(context.context))
+    {
+        glXMakeCurrent(context.device->display, None, nullptr);
+    }
+
+    glXDestroyContext(context.device->display, reinterpret_cast<GLXContext>(context.context));
+}
+
+} // namespace lepong::Graphics::GL
@@ -0,0 +1,169 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cstdio>
+
+#include "lepong/Check.h"
+#include "lepong/Graphics/GpuTimer.h"
+#include "lepong/Graphics/Graphics.h"
+#include "lepong/Time/Profiler.h"
+
+namespace lepong::Graphics::GpuTimer
+{
+
+static_assert(
+    static_cast<unsigned>(Profiler::Timer::GpuSwap) - static_cast<unsigned>(Profiler::Timer::GpuClear) ==
+    static_cast<unsigned>(Pass::Swap),
+    "Every pass has a profiler timer, in the same order");
+
+struct FrameQueries
+{
+    GLuint queries[skMaxTimestamps] = {};
+
+    // The pass each timestamp ends. The first timestamp is the beginning of the frame and doesn't end any pass.
+    Pass passes[skMaxTimestamps] = {};
+
+    unsigned numTimestamps = 0u;
+};
+
+static bool sInitialized = false;
+
+static FrameQueries sFrames[skLatency];
+static unsigned sCurrentFrame = 0u;
+
+static std::uint64_t sFrameTime = 0u;
+
+static std::uint64_t sNumFrames = 0u;
+static std::uint64_t sNumDroppedFrames = 0u;
+
+bool Init() noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(!sInitialized, false);
+
+    for (auto& frame : sFrames)
+    {
+        gl::GenQueries(skMaxTimestamps, frame.queries);
+        frame.numTimestamps = 0u;
+    }
+
+    sCurrentFrame = 0u;
+    sFrameTime = 0u;
+    sNumFrames = 0u;
+    sNumDroppedFrames = 0u;
+
+    sInitialized = true;
+    return true;
+}
+
+void Cleanup() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sInitialized);
+
+    for (auto& frame : sFrames)
+    {
+        gl::DeleteQueries(skMaxTimestamps, frame.queries);
+    }
+
+    char message[96];
+
+    std::snprintf(
+        message, sizeof(message), "GPU timer: %llu of %llu frames dropped",
+        static_cast<unsigned long long>(sNumDroppedFrames), static_cast<unsigned long long>(sNumFrames));
+
+    Log::Log(message);
+    sInitialized = false;
+}
+
+///
+/// Records the durations of the provided frame's passes if its results are available.
+///
+static void ReadBack(const FrameQueries& frame) noexcept;
+
+///
+/// Issues a timestamp query for the current frame.
+///
+static void Timestamp(Pass pass) noexcept;
+
+void BeginFrame() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sInitialized);
+
+    sCurrentFrame = (sCurrentFrame + 1u) % skLatency;
+    auto& frame = sFrames[sCurrentFrame];
+
+    ReadBack(frame);
+
+    frame.numTimestamps = 0u;
+    Timestamp(Pass::Count);
+}
+
+///
+/// \return The profiler timer of the provided pass.
+///
+LEPONG_NODISCARD static Profiler::Timer GetPassTimer(Pass pass) noexcept;
+
+void ReadBack(const FrameQueries& frame) noexcept
+{
+    // A frame without passes has nothing to report.
+    LEPONG_CHECK_OR_RETURN(frame.numTimestamps > 1u);
+
+    ++sNumFrames;
+
+    // Queries complete in order, the last one being available means they all are.
+    GLint available = 0;
+    gl::GetQueryObjectiv(frame.queries[frame.numTimestamps - 1u], gl::QueryResultAvailable, &available);
+
+    if (!available)
+    {
+        ++sNumDroppedFrames;
+        return;
+    }
+
+    GLuint64 timestamps[skMaxTimestamps];
+
+    for (unsigned i = 0; i < frame.numTimestamps; ++i)
+    {
+        gl::GetQueryObjectui64v(frame.queries[i], gl::QueryResult, &timestamps[i]);
+    }
+
+    for (unsigned i = 1; i < frame.numTimestamps; ++i)
+    {
+        Profiler::Record(GetPassTimer(frame.passes[i]), timestamps[i] - timestamps[i - 1u]);
+    }
+
+    sFrameTime = timestamps[frame.numTimestamps - 1u] - timestamps[0];
+    Profiler::Record(Profiler::Timer::GpuFrame, sFrameTime);
+}
+
+Profiler::Timer GetPassTimer(Pass pass) noexcept
+{
+    return static_cast<Profiler::Timer>(static_cast<unsigned>(Profiler::Timer::GpuClear) + static_cast<unsigned>(pass));
+}
+
+void EndPass(Pass pass) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sInitialized);
+
+    const auto& kFrame = sFrames[sCurrentFrame];
+    LEPONG_CHECK_OR_RETURN(kFrame.numTimestamps > 0u && kFrame.numTimestamps < skMaxTimestamps);
+
+    Timestamp(pass);
+}
+
+std::uint64_t GetFrameTime() noexcept
+{
+    return sFrameTime;
+}
+
+void Timestamp(Pass pass) noexcept
+{
+    auto& frame = sFrames[sCurrentFrame];
+
+    gl::QueryCounter(frame.queries[frame.numTimestamps], gl::Timestamp);
+    frame.passes[frame.numTimestamps] = pass;
+
+    ++frame.numTimestamps;
+}
+
+} // namespace lepong::Graphics::GpuTimer
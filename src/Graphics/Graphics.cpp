@@ -2,10 +2,10 @@
 // Created by lepouki on 10/12/2020.
 //
 
-#include <memory> // For std::make_unique.
 #include <Windows.h>
 
 #include "lepong/Check.h"
+#include "lepong/Graphics/FrameUniforms.h"
 #include "lepong/Graphics/Graphics.h"
 
 #include "LoadOpenGLFunction.h"
@@ -98,25 +98,23 @@ using PFNGetItemInfo = void (*)(GLuint, GLsizei, GLsizei*, GLchar*);
 ///
 /// Logs the provided object's info log.
 ///
-template<PFNGetItemiv GetItemivFunction, PFNGetItemInfo GetItemInfoFunction>
+template<PFNGetItemInfo GetItemInfoFunction>
 static void LogItemInfo(GLuint item) noexcept;
 
 void LogShaderInfo(GLuint shader) noexcept
 {
     Log::Log("Shader info:");
-    LogItemInfo<gl::GetShaderiv, gl::GetShaderInfoLog>(shader);
+    LogItemInfo<gl::GetShaderInfoLog>(shader);
 }
 
-template<PFNGetItemiv GetItemivFunction, PFNGetItemInfo GetItemInfoFunction>
+template<PFNGetItemInfo GetItemInfoFunction>
 static void LogItemInfo(GLuint item) noexcept
 {
-    const auto kInfoLogLength = GetItemiv<GetItemivFunction>(item, gl::InfoLogLength);
+    // Longer logs are truncated, this doesn't need to allocate.
+    GLchar infoLog[4096] = {};
 
-    const auto kInfoLog = std::make_unique<GLchar[]>(kInfoLogLength);
-    const auto kInfoLogData = kInfoLog.get();
-
-    GetItemInfoFunction(item, kInfoLogLength, nullptr, kInfoLogData);
-    Log::Log(kInfoLogData);
+    GetItemInfoFunction(item, sizeof(infoLog), nullptr, infoLog);
+    Log::Log(infoLog);
 }
 
 ///
@@ -129,6 +127,11 @@ LEPONG_NODISCARD static bool ProgramLinkFailed(GLuint program) noexcept;
 ///
 static void LogProgramInfo(GLuint program) noexcept;
 
+///
+/// Binds the provided program's frame uniform block to the frame uniform buffer, if the program declares it.
+///
+static void BindFrameBlock(GLuint program) noexcept;
+
 GLuint CreateProgramFromShaders(GLuint vert, GLuint frag) noexcept
 {
     LEPONG_CHECK_OR_RETURN_VAL(vert && frag, 0);
@@ -149,6 +152,10 @@ GLuint CreateProgramFromShaders(GLuint vert, GLuint frag) noexcept
         gl::DeleteProgram(program);
         program = 0;
     }
+    else
+    {
+        BindFrameBlock(program);
+    }
 
     return program;
 }
@@ -161,7 +168,39 @@ bool ProgramLinkFailed(GLuint program) noexcept
 void LogProgramInfo(GLuint program) noexcept
 {
     Log::Log("Program info:");
-    LogItemInfo<gl::GetProgramiv, gl::GetProgramInfoLog>(program);
+    LogItemInfo<gl::GetProgramInfoLog>(program);
+}
+
+void BindFrameBlock(GLuint program) noexcept
+{
+    const auto kIndex = gl::GetUniformBlockIndex(program, FrameUniforms::skBlockName);
+
+    if (kIndex != gl::InvalidIndex)
+    {
+        gl::UniformBlockBinding(program, kIndex, FrameUniforms::skBinding);
+    }
+}
+
+bool MakeRenderTarget(GLuint& texture, GLuint& framebuffer, const Vector2i& size) noexcept
+{
+    gl::GenTextures(1, &texture);
+    gl::GenFramebuffers(1, &framebuffer);
+
+    LEPONG_CHECK_OR_RETURN_VAL(texture && framebuffer, false);
+
+    // Software rasterizers have fast paths for filtering 8 bit RGBA textures, wasting three channels is cheaper.
+    gl::BindTexture(gl::Texture2D, texture);
+    gl::TexImage2D(gl::Texture2D, 0, gl::RGBA8, size.x, size.y, 0, gl::RGBA, gl::UnsignedByte, nullptr);
+
+    gl::TexParameteri(gl::Texture2D, gl::TextureMinFilter, gl::Linear);
+    gl::TexParameteri(gl::Texture2D, gl::TextureMagFilter, gl::Linear);
+    gl::TexParameteri(gl::Texture2D, gl::TextureWrapS, gl::ClampToEdge);
+    gl::TexParameteri(gl::Texture2D, gl::TextureWrapT, gl::ClampToEdge);
+
+    gl::BindFramebuffer(gl::Framebuffer, framebuffer);
+    gl::FramebufferTexture2D(gl::Framebuffer, gl::ColorAttachment0, gl::Texture2D, texture, 0);
+
+    return gl::CheckFramebufferStatus(gl::Framebuffer) == gl::FramebufferComplete;
 }
 
 PROC LoadOpenGLFunction(const char* name) noexcept
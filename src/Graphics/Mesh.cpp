@@ -2,8 +2,6 @@
 // Created by lepouki on 10/23/2020.
 //
 
-#include <numeric> // For std::accumulate.
-
 #include "lepong/Check.h"
 #include "lepong/Graphics/Mesh.h"
 
@@ -13,9 +11,9 @@ namespace lepong::Graphics
 ///
 /// Loads the mesh data to the mesh.
 ///
-static void LoadMeshData(Mesh& mesh, const Vertices& vertices, const Indices& indices) noexcept;
+static void LoadMeshData(Mesh& mesh, Span<GLfloat> vertices, Span<GLuint> indices) noexcept;
 
-Mesh MakeMesh(const Vertices& vertices, const Indices& indices) noexcept
+Mesh MakeMesh(Span<GLfloat> vertices, Span<GLuint> indices) noexcept
 {
     Mesh mesh = {};
     gl::GenVertexArrays(1, &mesh.va);
@@ -32,49 +30,47 @@ Mesh MakeMesh(const Vertices& vertices, const Indices& indices) noexcept
 ///
 /// I wonder what this does.
 ///
-static void LoadVertexData(Mesh& mesh, const Vertices& vertices) noexcept;
+static void LoadVertexData(Mesh& mesh, Span<GLfloat> vertices) noexcept;
 
 ///
 /// Loads the indices to the mesh.
 ///
-static void LoadIndexData(Mesh& mesh, const Indices& indices) noexcept;
+static void LoadIndexData(Mesh& mesh, Span<GLuint> indices) noexcept;
 
-void LoadMeshData(Mesh& mesh, const Vertices& vertices, const Indices& indices) noexcept
+void LoadMeshData(Mesh& mesh, Span<GLfloat> vertices, Span<GLuint> indices) noexcept
 {
     LoadVertexData(mesh, vertices);
     LoadIndexData(mesh, indices);
 }
 
-void LoadVertexData(Mesh& mesh, const Vertices& vertices) noexcept
+void LoadVertexData(Mesh& mesh, Span<GLfloat> vertices) noexcept
 {
     gl::GenBuffers(1, &mesh.vb);
     gl::BindBuffer(gl::ArrayBuffer, mesh.vb);
 
-    using ValueType = Vertices::value_type;
-    gl::BufferData(gl::ArrayBuffer, sizeof(ValueType) * vertices.size(), vertices.data(), gl::StaticDraw);
+    gl::BufferData(gl::ArrayBuffer, sizeof(GLfloat) * vertices.size, vertices.data, gl::StaticDraw);
 }
 
-void LoadIndexData(Mesh& mesh, const Indices& indices) noexcept
+void LoadIndexData(Mesh& mesh, Span<GLuint> indices) noexcept
 {
     gl::GenBuffers(1, &mesh.ib);
     gl::BindBuffer(gl::ElementArrayBuffer, mesh.ib);
 
-    using ValueType = Indices::value_type;
-    gl::BufferData(gl::ElementArrayBuffer, sizeof(ValueType) * indices.size(), indices.data(), gl::StaticDraw);
+    gl::BufferData(gl::ElementArrayBuffer, sizeof(GLuint) * indices.size, indices.data, gl::StaticDraw);
 
-    mesh.numIndices = indices.size();
+    mesh.numIndices = static_cast<GLuint>(indices.size);
 }
 
-void SetMeshVertexLayout(const Mesh& mesh, const VertexLayout& vertexLayout) noexcept
+void SetMeshVertexLayout(const Mesh& mesh, Span<GLuint> vertexLayout) noexcept
 {
     LEPONG_CHECK_OR_RETURN(mesh.va);
 
     gl::BindVertexArray(mesh.va);
 
-    const auto kStride = std::accumulate(vertexLayout.begin(), vertexLayout.end(), 0u) * sizeof(GLfloat);
+    const auto kStride = GetVertexStride(vertexLayout) * sizeof(GLfloat);
     GLsizeiptr attributeOffset = 0;
 
-    for (GLuint i = 0; i < vertexLayout.size(); ++i)
+    for (GLuint i = 0; i < vertexLayout.size; ++i)
     {
         gl::EnableVertexAttribArray(i);
 
@@ -85,6 +81,32 @@ void SetMeshVertexLayout(const Mesh& mesh, const VertexLayout& vertexLayout) noe
     }
 }
 
+void SetMeshInstanceLayout(
+    const Mesh& mesh, GLuint buffer, GLsizeiptr offset, GLuint firstAttribute, Span<GLuint> instanceLayout) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(mesh.va);
+
+    gl::BindVertexArray(mesh.va);
+    gl::BindBuffer(gl::ArrayBuffer, buffer);
+
+    const auto kStride = GetVertexStride(instanceLayout) * sizeof(GLfloat);
+    auto attributeOffset = offset;
+
+    for (GLuint i = 0; i < instanceLayout.size; ++i)
+    {
+        const auto kAttribute = firstAttribute + i;
+        gl::EnableVertexAttribArray(kAttribute);
+
+        const auto kAttributeSize = instanceLayout[i];
+        gl::VertexAttribPointer(kAttribute, kAttributeSize, gl::Float, gl::False, kStride, (void*)attributeOffset);
+
+        // Advance once per instance instead of once per vertex.
+        gl::VertexAttribDivisor(kAttribute, 1);
+
+        attributeOffset += kAttributeSize * sizeof(GLfloat);
+    }
+}
+
 void DrawMesh(const Mesh& mesh) noexcept
 {
     LEPONG_CHECK_OR_RETURN( mesh.va);
@@ -94,6 +116,15 @@ void DrawMesh(const Mesh& mesh) noexcept
     gl::DrawElements(gl::Triangles, mesh.numIndices, gl::UnsignedInt, nullptr);
 }
 
+void DrawMeshInstanced(const Mesh& mesh, GLsizei numInstances) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(mesh.va);
+
+    gl::BindBuffer(gl::ElementArrayBuffer, mesh.ib);
+    gl::BindVertexArray(mesh.va);
+    gl::DrawElementsInstanced(gl::Triangles, mesh.numIndices, gl::UnsignedInt, nullptr, numInstances);
+}
+
 void DestroyMesh(Mesh& mesh) noexcept
 {
     LEPONG_CHECK_OR_RETURN(mesh.va);
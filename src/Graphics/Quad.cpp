@@ -2,62 +2,56 @@
 // Created by lepouki on 10/23/2020.
 //
 
+#include "lepong/Graphics/FrameUniforms.h"
 #include "lepong/Graphics/Quad.h"
 
 namespace lepong::Graphics
 {
 
-///
-/// Creates a quad mesh and sets its vertex layout to the provided layout.
-///
-LEPONG_NODISCARD static Mesh MakeQuadWithLayout(const Vertices& vertices, const VertexLayout& vertexLayout) noexcept;
+// Every quad is made of the same two triangles.
+static constexpr std::array<GLuint, 6> skQuadIndices =
+{
+    0, 1, 2,
+    0, 2, 3
+};
 
-Mesh MakeSimpleQuad() noexcept
+static constexpr MeshDescription<8, 6, 1> skSimpleQuad =
 {
-    const Vertices kVertices =
     {
         -0.5f, -0.5f,
         -0.5f,  0.5f,
          0.5f,  0.5f,
          0.5f, -0.5f
-    };
+    },
+    skQuadIndices,
+    { 2 }
+};
 
-    const VertexLayout kVertexLayout = { 2 };
+static_assert(skSimpleQuad.IsValid());
 
-    return MakeQuadWithLayout(kVertices, kVertexLayout);
-}
-
-Mesh MakeQuadWithLayout(const Vertices& vertices, const VertexLayout& vertexLayout) noexcept
+static constexpr MeshDescription<16, 6, 2> skTexturedQuad =
 {
-    const Indices kIndices =
-    {
-        0, 1, 2,
-        0, 2, 3
-    };
-
-    const auto kNewMesh = MakeMesh(vertices, kIndices);
-
-    if (kNewMesh.va)
-    {
-        SetMeshVertexLayout(kNewMesh, vertexLayout);
-    }
-
-    return kNewMesh;
-}
-
-Mesh MakeTexturedQuad() noexcept
-{
-    const Vertices kVertices =
     {
         -0.5f, -0.5f, 0.0f, 0.0f,
         -0.5f,  0.5f, 0.0f, 1.0f,
          0.5f,  0.5f, 1.0f, 1.0f,
          0.5f, -0.5f, 1.0f, 0.0f
-    };
+    },
+    skQuadIndices,
+    { 2, 2 }
+};
 
-    const VertexLayout kVertexLayout = { 2, 2 };
+static_assert(skTexturedQuad.IsValid());
+static_assert(GetAttributeOffset(skTexturedQuad.vertexLayout, 1) == 2u);
 
-    return MakeQuadWithLayout(kVertices, kVertexLayout);
+Mesh MakeSimpleQuad() noexcept
+{
+    return MakeMesh(skSimpleQuad);
+}
+
+Mesh MakeTexturedQuad() noexcept
+{
+    return MakeMesh(skTexturedQuad);
 }
 
 GLuint MakeQuadVertexShader() noexcept
@@ -67,9 +61,9 @@ GLuint MakeQuadVertexShader() noexcept
 
     #version 330 core
 
-    layout (location = 0) in vec2 aPosition;
+    )" LEPONG_GLSL_FRAME_BLOCK R"(
 
-    uniform vec2 uWinSize;
+    layout (location = 0) in vec2 aPosition;
 
     uniform vec2 uSize;
     uniform vec2 uPosition;
@@ -77,7 +71,7 @@ GLuint MakeQuadVertexShader() noexcept
     void main()
     {
         vec2 position = (aPosition * uSize) + uPosition;
-        gl_Position = vec4(position * 2.0 / uWinSize - vec2(1.0, 1.0), 0.0, 1.0);
+        gl_Position = uProjection * vec4(position, 0.0, 1.0);
     }
 
     )";
@@ -92,20 +86,71 @@ GLuint MakeTexturedQuadVertexShader() noexcept
 
     #version 330 core
 
+    )" LEPONG_GLSL_FRAME_BLOCK R"(
+
     layout (location = 0) in vec2 aPosition;
     layout (location = 1) in vec2 aTextureCoords;
 
     out vec2 vTextureCoords;
 
-    uniform vec2 uWinSize;
-
     uniform vec2 uSize;
     uniform vec2 uPosition;
 
     void main()
     {
         vec2 position = (aPosition * uSize) + uPosition;
-        gl_Position = vec4(position * 2.0 / uWinSize - vec2(1.0), 0.0, 1.0);
+        gl_Position = uProjection * vec4(position, 0.0, 1.0);
+
+        vTextureCoords = aTextureCoords;
+    }
+
+    )";
+
+    return Graphics::CreateShaderFromSource(gl::VertexShader, kSource);
+}
+
+GLuint MakeInstancedQuadVertexShader() noexcept
+{
+    constexpr auto kSource =
+    R"(
+
+    #version 330 core
+
+    )" LEPONG_GLSL_FRAME_BLOCK R"(
+
+    layout (location = 0) in vec2 aPosition;
+    layout (location = 2) in vec4 aInstance;
+
+    void main()
+    {
+        vec2 position = (aPosition * aInstance.zw) + aInstance.xy;
+        gl_Position = uProjection * vec4(position, 0.0, 1.0);
+    }
+
+    )";
+
+    return Graphics::CreateShaderFromSource(gl::VertexShader, kSource);
+}
+
+GLuint MakeInstancedTexturedQuadVertexShader() noexcept
+{
+    constexpr auto kSource =
+    R"(
+
+    #version 330 core
+
+    )" LEPONG_GLSL_FRAME_BLOCK R"(
+
+    layout (location = 0) in vec2 aPosition;
+    layout (location = 1) in vec2 aTextureCoords;
+    layout (location = 2) in vec4 aInstance;
+
+    out vec2 vTextureCoords;
+
+    void main()
+    {
+        vec2 position = (aPosition * aInstance.zw) + aInstance.xy;
+        gl_Position = uProjection * vec4(position, 0.0, 1.0);
 
         vTextureCoords = aTextureCoords;
     }
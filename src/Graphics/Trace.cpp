@@ -0,0 +1,97 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "lepong/Check.h"
+#include "lepong/Graphics/Trace.h"
+
+namespace lepong::Graphics::Trace
+{
+
+static std::FILE* sFile = nullptr;
+
+bool IsSelected() noexcept
+{
+    const auto kPath = std::getenv(skSelectionVariable);
+    return kPath && kPath[0];
+}
+
+bool StartRecording(const Vector2i& winSize) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(!sFile, false);
+
+    // The standard library is used instead of the Windows API so the interface can be traced on every platform.
+    const auto kPath = std::getenv(skSelectionVariable);
+    LEPONG_CHECK_OR_RETURN_VAL(kPath && kPath[0], false);
+
+    sFile = std::fopen(kPath, "wb");
+    LEPONG_CHECK_OR_RETURN_VAL(sFile, false);
+
+    TraceHeader header;
+    header.magic = skMagic;
+    header.version = skVersion;
+    header.winSizeX = winSize.x;
+    header.winSizeY = winSize.y;
+
+    Write(&header, sizeof(TraceHeader));
+    sRecording = true;
+
+    return true;
+}
+
+void StopRecording() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sFile);
+
+    std::fclose(sFile);
+    sFile = nullptr;
+    sRecording = false;
+}
+
+void RecordFrameEnd() noexcept
+{
+    Record(Call::FrameEnd);
+}
+
+void Write(const void* data, std::size_t size) noexcept
+{
+    // The file is buffered, most calls only copy a few bytes.
+    std::fwrite(data, 1, size, sFile);
+}
+
+void WriteArgument(const Blob& blob) noexcept
+{
+    WriteArgument(blob.size);
+    Write(blob.data, blob.size);
+}
+
+void WriteArgument(const Names& names) noexcept
+{
+    const auto kCount = static_cast<std::uint32_t>(names.count);
+
+    WriteArgument(kCount);
+    Write(names.names, kCount * sizeof(GLuint));
+}
+
+void WriteArgument(const Sources& sources) noexcept
+{
+    WriteArgument(static_cast<std::uint32_t>(sources.count));
+
+    for (auto i = 0; i < sources.count; ++i)
+    {
+        const auto kString = sources.strings[i];
+
+        // Negative lengths also mean the string is null terminated.
+        const auto kLength = sources.lengths && sources.lengths[i] >= 0
+            ? static_cast<std::uint32_t>(sources.lengths[i])
+            : static_cast<std::uint32_t>(std::strlen(kString));
+
+        WriteArgument(Blob{ kString, kLength });
+    }
+}
+
+} // namespace lepong::Graphics::Trace
@@ -15,7 +15,8 @@ bool Init() noexcept
 {
     LEPONG_CHECK_OR_RETURN_VAL(!sLog, false);
 
-    return !fopen_s(&sLog, "lepong.log", "w");
+    sLog = std::fopen("lepong.log", "w");
+    return sLog != nullptr;
 }
 
 void Cleanup() noexcept
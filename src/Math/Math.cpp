@@ -9,9 +9,38 @@
 namespace lepong
 {
 
+// Xorshift32, the state must never be 0.
+// Every thread has its own state so that matches can be simulated in parallel.
+static thread_local std::uint32_t sRandomState = 1u;
+
+void SeedRandom(std::uint32_t seed) noexcept
+{
+    sRandomState = seed ? seed : 0x9E3779B9u;
+}
+
+std::uint32_t GetRandomState() noexcept
+{
+    return sRandomState;
+}
+
+///
+/// Advances the random number generator and returns its new state.
+///
+LEPONG_NODISCARD static std::uint32_t NextRandom() noexcept;
+
 int RandomSign() noexcept
 {
-    return rand() > (RAND_MAX / 2) ? 1 : -1; // NOLINT: Don't need particularly good random.
+    // The high bit is the best mixed one.
+    return (NextRandom() & 0x80000000u) ? 1 : -1;
+}
+
+std::uint32_t NextRandom() noexcept
+{
+    sRandomState ^= sRandomState << 13u;
+    sRandomState ^= sRandomState >> 17u;
+    sRandomState ^= sRandomState << 5u;
+
+    return sRandomState;
 }
 
 float RandomSignFloat() noexcept
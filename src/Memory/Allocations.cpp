@@ -0,0 +1,486 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+#include <crtdbg.h> // For _CrtSetAllocHook.
+#endif
+
+#include "lepong/Check.h"
+#include "lepong/Memory/Allocations.h"
+
+#if defined(__GLIBC__)
+// Every malloc goes through our definitions, the C library's are still reachable under these names.
+extern "C" void* __libc_malloc(std::size_t size);
+extern "C" void* __libc_calloc(std::size_t count, std::size_t size);
+extern "C" void* __libc_realloc(void* memory, std::size_t size);
+extern "C" void* __libc_memalign(std::size_t alignment, std::size_t size);
+extern "C" void __libc_free(void* memory);
+#define LEPONG_MALLOC __libc_malloc
+#define LEPONG_ALIGNED_MALLOC(alignment, size) __libc_memalign(alignment, size)
+#define LEPONG_FREE __libc_free
+#elif defined(_MSC_VER)
+#define LEPONG_MALLOC std::malloc
+#define LEPONG_ALIGNED_MALLOC(alignment, size) _aligned_malloc(size, alignment)
+#define LEPONG_FREE std::free
+#else
+#define LEPONG_MALLOC std::malloc
+#define LEPONG_ALIGNED_MALLOC(alignment, size) std::aligned_alloc(alignment, size)
+#define LEPONG_FREE std::free
+#endif
+
+namespace lepong::Allocations
+{
+
+static constexpr auto skNumPhases = static_cast<unsigned>(Phase::Count);
+
+static constexpr const char* skPhaseNames[] =
+{
+    "init",
+    "frame",
+    "cleanup"
+};
+
+static_assert(sizeof(skPhaseNames) / sizeof(skPhaseNames[0]) == skNumPhases);
+
+static bool sInitialized = false;
+
+// Allocations happen before main and on any thread, so the counters are only touched with relaxed atomics.
+static PhaseCounters sPhaseCounters[skNumPhases];
+static std::atomic<unsigned> sPhase = 0u;
+
+static std::atomic<bool> sStrict = false;
+static std::atomic<std::uint64_t> sNumFrames = 0u;
+
+static std::atomic<std::uint64_t> sNumViolations = 0u;
+static std::atomic<std::uint64_t> sFirstViolationSize = 0u;
+
+static thread_local unsigned tHotSectionDepth = 0u;
+
+///
+/// Counts an allocation and checks the hot section rule.
+///
+static void TrackAllocation(std::size_t size) noexcept;
+
+///
+/// Counts a free.
+///
+static void TrackFree() noexcept;
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+// operator new already counts its own mallocs.
+static thread_local bool tInOperatorNew = false;
+
+///
+/// Counts the C runtime heap operations that didn't come from operator new.
+///
+static int OnCrtAllocation(
+    int type, void*, std::size_t size, int, long, const unsigned char*, int) noexcept
+{
+    if (!tInOperatorNew)
+    {
+        if (type == _HOOK_FREE)
+        {
+            TrackFree();
+        }
+        else
+        {
+            TrackAllocation(size);
+        }
+    }
+
+    return 1; // Lets the operation through.
+}
+#endif
+
+bool Init() noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(!sInitialized, false);
+
+    const auto kValue = std::getenv(skStrictModeVariable);
+    SetStrict(kValue && kValue[0] == '1');
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+    _CrtSetAllocHook(OnCrtAllocation);
+#endif
+
+    sInitialized = true;
+    return true;
+}
+
+void Cleanup() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sInitialized);
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+    _CrtSetAllocHook(nullptr);
+#endif
+
+    LogReport();
+    sInitialized = false;
+}
+
+void SetPhase(Phase phase) noexcept
+{
+    sPhase.store(static_cast<unsigned>(phase), std::memory_order_relaxed);
+}
+
+void SetStrict(bool strict) noexcept
+{
+    sStrict.store(strict, std::memory_order_relaxed);
+}
+
+void BeginHotSection() noexcept
+{
+    ++tHotSectionDepth;
+}
+
+void EndHotSection() noexcept
+{
+    --tHotSectionDepth;
+}
+
+void OnFrameEnd() noexcept
+{
+    sNumFrames.fetch_add(1u, std::memory_order_relaxed);
+}
+
+const PhaseCounters& GetPhaseCounters(Phase phase) noexcept
+{
+    return sPhaseCounters[static_cast<unsigned>(phase)];
+}
+
+std::uint64_t GetNumViolations() noexcept
+{
+    return sNumViolations.load(std::memory_order_relaxed);
+}
+
+void LogReport() noexcept
+{
+    char message[128];
+
+    for (unsigned i = 0; i < skNumPhases; ++i)
+    {
+        const auto& kCounters = sPhaseCounters[i];
+
+        std::snprintf(
+            message, sizeof(message), "Allocations during %s: %llu (%llu bytes), %llu frees",
+            skPhaseNames[i],
+            static_cast<unsigned long long>(kCounters.numAllocations.load(std::memory_order_relaxed)),
+            static_cast<unsigned long long>(kCounters.numBytes.load(std::memory_order_relaxed)),
+            static_cast<unsigned long long>(kCounters.numFrees.load(std::memory_order_relaxed)));
+
+        Log::Log(message);
+    }
+
+    const auto kNumViolations = GetNumViolations();
+    LEPONG_CHECK_OR_RETURN(kNumViolations);
+
+    std::snprintf(
+        message, sizeof(message), "%llu allocations on the hot path after warm-up, the first one of %llu bytes",
+        static_cast<unsigned long long>(kNumViolations),
+        static_cast<unsigned long long>(sFirstViolationSize.load(std::memory_order_relaxed)));
+
+    Log::Log(message);
+}
+
+void TrackAllocation(std::size_t size) noexcept
+{
+    auto& counters = sPhaseCounters[sPhase.load(std::memory_order_relaxed)];
+
+    counters.numAllocations.fetch_add(1u, std::memory_order_relaxed);
+    counters.numBytes.fetch_add(size, std::memory_order_relaxed);
+
+    LEPONG_CHECK_OR_RETURN(tHotSectionDepth && sNumFrames.load(std::memory_order_relaxed) >= skWarmUpFrames);
+
+    if (sNumViolations.fetch_add(1u, std::memory_order_relaxed) == 0u)
+    {
+        sFirstViolationSize.store(size, std::memory_order_relaxed);
+    }
+
+    // Aborting right away gives a debugger, or the flight recorder, the offending call stack.
+    if (sStrict.load(std::memory_order_relaxed))
+    {
+        std::abort();
+    }
+}
+
+void TrackFree() noexcept
+{
+    sPhaseCounters[sPhase.load(std::memory_order_relaxed)].numFrees.fetch_add(1u, std::memory_order_relaxed);
+}
+
+///
+/// The common part of every operator new.
+///
+LEPONG_NODISCARD static void* Allocate(std::size_t size) noexcept
+{
+    TrackAllocation(size);
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+    tInOperatorNew = true;
+    const auto kMemory = LEPONG_MALLOC(size ? size : 1u);
+    tInOperatorNew = false;
+
+    return kMemory;
+#else
+    return LEPONG_MALLOC(size ? size : 1u);
+#endif
+}
+
+///
+/// The common part of every operator delete.
+///
+static void Free(void* memory) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(memory);
+
+    TrackFree();
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+    tInOperatorNew = true;
+    LEPONG_FREE(memory);
+    tInOperatorNew = false;
+#else
+    LEPONG_FREE(memory);
+#endif
+}
+
+///
+/// The common part of every over-aligned operator new.
+///
+LEPONG_NODISCARD static void* AllocateAligned(std::size_t size, std::align_val_t alignment) noexcept
+{
+    TrackAllocation(size);
+
+    const auto kAlignment = static_cast<std::size_t>(alignment);
+    const auto kSize = (size + kAlignment - 1u) / kAlignment * kAlignment;
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+    tInOperatorNew = true;
+    const auto kMemory = LEPONG_ALIGNED_MALLOC(kAlignment, kSize ? kSize : kAlignment);
+    tInOperatorNew = false;
+
+    return kMemory;
+#else
+    return LEPONG_ALIGNED_MALLOC(kAlignment, kSize ? kSize : kAlignment);
+#endif
+}
+
+///
+/// The common part of every over-aligned operator delete.
+///
+static void FreeAligned(void* memory) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(memory);
+
+    TrackFree();
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+    tInOperatorNew = true;
+    _aligned_free(memory);
+    tInOperatorNew = false;
+#elif defined(_MSC_VER)
+    _aligned_free(memory);
+#else
+    LEPONG_FREE(memory);
+#endif
+}
+
+} // namespace lepong::Allocations
+
+// The replaceable allocation functions. Only the throwing ones are required to throw.
+
+void* operator new(std::size_t size)
+{
+    const auto kMemory = lepong::Allocations::Allocate(size);
+
+    if (!kMemory)
+    {
+        throw std::bad_alloc();
+    }
+
+    return kMemory;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return lepong::Allocations::Allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return lepong::Allocations::Allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    const auto kMemory = lepong::Allocations::AllocateAligned(size, alignment);
+
+    if (!kMemory)
+    {
+        throw std::bad_alloc();
+    }
+
+    return kMemory;
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return lepong::Allocations::AllocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return lepong::Allocations::AllocateAligned(size, alignment);
+}
+
+void operator delete(void* memory) noexcept
+{
+    lepong::Allocations::Free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    lepong::Allocations::Free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    lepong::Allocations::Free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    lepong::Allocations::Free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+    lepong::Allocations::Free(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+    lepong::Allocations::Free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+    lepong::Allocations::FreeAligned(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept
+{
+    lepong::Allocations::FreeAligned(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept
+{
+    lepong::Allocations::FreeAligned(memory);
+}
+
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept
+{
+    lepong::Allocations::FreeAligned(memory);
+}
+
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    lepong::Allocations::FreeAligned(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    lepong::Allocations::FreeAligned(memory);
+}
+
+#if defined(__GLIBC__)
+extern "C"
+{
+
+void* malloc(std::size_t size)
+{
+    lepong::Allocations::TrackAllocation(size);
+    return __libc_malloc(size);
+}
+
+void* calloc(std::size_t count, std::size_t size)
+{
+    // The C library fails the overflowing ones, they are not counted.
+    if (!count || size <= SIZE_MAX / count)
+    {
+        lepong::Allocations::TrackAllocation(count * size);
+    }
+
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* memory, std::size_t size)
+{
+    lepong::Allocations::TrackAllocation(size);
+    return __libc_realloc(memory, size);
+}
+
+// The aligned allocations are freed with free, they must be counted too.
+
+void* memalign(std::size_t alignment, std::size_t size)
+{
+    lepong::Allocations::TrackAllocation(size);
+    return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(std::size_t alignment, std::size_t size)
+{
+    lepong::Allocations::TrackAllocation(size);
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** memory, std::size_t alignment, std::size_t size)
+{
+    // A power of two multiple of sizeof(void*), like the C library checks it.
+    if (alignment % sizeof(void*) != 0u || (alignment & (alignment - 1u)) != 0u)
+    {
+        return EINVAL;
+    }
+
+    lepong::Allocations::TrackAllocation(size);
+    const auto kMemory = __libc_memalign(alignment, size);
+
+    if (!kMemory)
+    {
+        return ENOMEM;
+    }
+
+    *memory = kMemory;
+    return 0;
+}
+
+void free(void* memory)
+{
+    if (memory)
+    {
+        lepong::Allocations::TrackFree();
+    }
+
+    __libc_free(memory);
+}
+
+} // extern "C"
+#endif
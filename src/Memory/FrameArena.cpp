@@ -0,0 +1,185 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "lepong/Check.h"
+#include "lepong/Memory/FrameArena.h"
+
+namespace lepong::FrameArena
+{
+
+static Arena sMainArena;
+
+static thread_local Arena* tArena = nullptr;
+
+// The statistics of the destroyed arenas with a given name. Arenas are destroyed from any thread.
+struct ReportEntry
+{
+    std::atomic<const char*> name = nullptr;
+
+    std::atomic<std::size_t> capacity = 0u;
+    std::atomic<std::size_t> highWaterMark = 0u;
+    std::atomic<std::uint64_t> numOverflows = 0u;
+    std::atomic<unsigned> numArenas = 0u;
+};
+
+static ReportEntry sReport[skMaxReportedArenas];
+
+bool Init() noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(!sMainArena.IsValid(), false);
+
+    sMainArena = MakeArena("main", skMainArenaSize, OverflowPolicy::ReturnNull);
+    LEPONG_CHECK_OR_LOG(sMainArena.IsValid(), "Failed to allocate the main frame arena");
+    LEPONG_CHECK_OR_RETURN_VAL(sMainArena.IsValid(), false);
+
+    BindThreadArena(&sMainArena);
+    return true;
+}
+
+void Cleanup() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sMainArena.IsValid());
+
+    BindThreadArena(nullptr);
+    DestroyArena(sMainArena);
+
+    LogReport();
+}
+
+///
+/// Adds the provided arena's statistics to the report entry of its name, if there is room left.
+///
+static void AddToReport(const Arena& arena) noexcept;
+
+Arena MakeArena(const char* name, std::size_t capacity, OverflowPolicy overflowPolicy) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(capacity, Arena{});
+
+    Arena arena;
+    arena.name = name;
+    arena.capacity = capacity;
+    arena.overflowPolicy = overflowPolicy;
+
+    // Both buffers in a single allocation.
+    const auto kMemory = static_cast<std::uint8_t*>(std::malloc(capacity * 2u));
+    LEPONG_CHECK_OR_RETURN_VAL(kMemory, Arena{});
+
+    arena.buffers[0] = kMemory;
+    arena.buffers[1] = kMemory + capacity;
+
+    return arena;
+}
+
+void DestroyArena(Arena& arena) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(arena.IsValid());
+
+    AddToReport(arena);
+    std::free(arena.buffers[0]);
+
+    arena = Arena{};
+}
+
+void BindThreadArena(Arena* arena) noexcept
+{
+    tArena = arena;
+}
+
+///
+/// Raises the provided maximum to the provided value.
+///
+template<typename T>
+static void UpdateMaximum(std::atomic<T>& maximum, T value) noexcept
+{
+    auto current = maximum.load(std::memory_order_relaxed);
+
+    while (current < value && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+void AddToReport(const Arena& arena) noexcept
+{
+    const auto kName = arena.name ? arena.name : "?";
+
+    for (auto& entry : sReport)
+    {
+        // The first arena with a new name claims a free entry, the others find it by name.
+        const char* name = nullptr;
+
+        if (!entry.name.compare_exchange_strong(name, kName) && std::strcmp(name, kName) != 0)
+        {
+            continue;
+        }
+
+        UpdateMaximum(entry.capacity, arena.capacity);
+        UpdateMaximum(entry.highWaterMark, arena.highWaterMark);
+        entry.numOverflows.fetch_add(arena.numOverflows, std::memory_order_relaxed);
+
+        // Counted last, LogReport skips the entry until then.
+        entry.numArenas.fetch_add(1u, std::memory_order_release);
+        return;
+    }
+}
+
+Arena* GetThreadArena() noexcept
+{
+    return tArena;
+}
+
+void BeginFrame() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(tArena);
+
+    BeginFrame(*tArena);
+}
+
+void BeginFrame(Arena& arena) noexcept
+{
+    arena.current ^= 1u;
+    arena.offset = 0u;
+}
+
+void LogReport() noexcept
+{
+    for (const auto& kEntry : sReport)
+    {
+        const auto kNumArenas = kEntry.numArenas.load(std::memory_order_acquire);
+
+        if (!kNumArenas)
+        {
+            continue;
+        }
+
+        // Arenas with the same name are sized alike, the largest values are the ones to size them by.
+        char message[160];
+        std::snprintf(
+            message, sizeof(message), "Frame arena %s: %zu of %zu bytes used at most, %llu overflows, %u arena%s",
+            kEntry.name.load(), kEntry.highWaterMark.load(std::memory_order_relaxed),
+            kEntry.capacity.load(std::memory_order_relaxed),
+            static_cast<unsigned long long>(kEntry.numOverflows.load(std::memory_order_relaxed)), kNumArenas,
+            kNumArenas > 1u ? "s" : "");
+
+        Log::Log(message);
+    }
+}
+
+void* Overflow(Arena& arena) noexcept
+{
+    ++arena.numOverflows;
+
+    if (arena.overflowPolicy == OverflowPolicy::Abort)
+    {
+        std::abort();
+    }
+
+    return nullptr;
+}
+
+} // namespace lepong::FrameArena
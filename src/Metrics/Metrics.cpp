@@ -0,0 +1,214 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cstdio>
+#include <Windows.h>
+
+#include "lepong/Check.h"
+#include "lepong/FileMapping.h"
+#include "lepong/Metrics/Metrics.h"
+
+namespace lepong::Metrics
+{
+
+static bool sInitialized = false;
+
+static FileMapping::Mapping sMapping;
+
+// Used when the region can't be mapped, so recording never has to check anything.
+static InstanceMetrics sLocalInstance;
+
+static InstanceMetrics* sInstance = &sLocalInstance;
+
+void GetRegionPath(char* path, std::size_t size) noexcept
+{
+    char directory[MAX_PATH];
+    const auto kLength = GetTempPathA(MAX_PATH, directory);
+
+    std::snprintf(path, size, "%slepong-metrics.bin", kLength ? directory : "");
+}
+
+std::uint64_t GetHeartbeatTime() noexcept
+{
+    return GetTickCount64();
+}
+
+///
+/// Writes the region header if no instance did it yet.
+///
+/// \return Whether the region has the expected layout.
+///
+LEPONG_NODISCARD static bool PrepareRegion(Region& region) noexcept;
+
+///
+/// Claims a free or abandoned slot in the region.
+///
+/// \return The claimed slot or <code>nullptr</code> if every slot is taken.
+///
+LEPONG_NODISCARD static InstanceMetrics* ClaimSlot(Region& region) noexcept;
+
+bool Init() noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(!sInitialized, false);
+
+    sInitialized = true;
+
+    char path[MAX_PATH];
+    GetRegionPath(path, sizeof(path));
+
+    sMapping = FileMapping::MakeReadWriteMapping(path, sizeof(Region));
+
+    if (sMapping.IsValid())
+    {
+        auto& region = *static_cast<Region*>(sMapping.data);
+        const auto kSlot = PrepareRegion(region) ? ClaimSlot(region) : nullptr;
+
+        if (kSlot)
+        {
+            sInstance = kSlot;
+            return true;
+        }
+
+        FileMapping::DestroyMapping(sMapping);
+    }
+
+    Log::Log("Failed to map the metrics region, metrics are not shared");
+    return true;
+}
+
+///
+/// Writes the region header and publishes it.
+///
+static void WriteRegionHeader(Region& region) noexcept;
+
+bool PrepareRegion(Region& region) noexcept
+{
+    // The first instance to see a zeroed file writes the header.
+    std::uint32_t expected = 0u;
+
+    if (region.magic.compare_exchange_strong(expected, skRegionMagic - 1u))
+    {
+        WriteRegionHeader(region);
+    }
+
+    // Another instance may still be writing the header. If it died doing so, the header is written again, which
+    // is harmless even if it was only slow since both write the same values.
+    const auto kWaitStart = GetHeartbeatTime();
+
+    while (region.magic.load(std::memory_order_acquire) == skRegionMagic - 1u)
+    {
+        if (GetHeartbeatTime() - kWaitStart > skHeartbeatTimeout)
+        {
+            Log::Log("Taking over the metrics region header from an instance that stopped writing it");
+
+            WriteRegionHeader(region);
+            break;
+        }
+
+        Sleep(1);
+    }
+
+    return
+        region.magic.load(std::memory_order_acquire) == skRegionMagic &&
+        region.version == skRegionVersion &&
+        region.slotSize == sizeof(InstanceMetrics);
+}
+
+void WriteRegionHeader(Region& region) noexcept
+{
+    region.version = skRegionVersion;
+    region.numSlots = skMaxInstances;
+    region.slotSize = sizeof(InstanceMetrics);
+
+    region.magic.store(skRegionMagic, std::memory_order_release);
+}
+
+///
+/// Clears the provided slot's values.
+///
+static void ResetSlot(InstanceMetrics& slot) noexcept;
+
+InstanceMetrics* ClaimSlot(Region& region) noexcept
+{
+    const auto kProcessId = static_cast<std::uint32_t>(GetCurrentProcessId());
+
+    for (auto& slot : region.slots)
+    {
+        // Free slots have no heartbeat, abandoned ones an old one. The slot is claimed by refreshing its heartbeat:
+        // once it is fresh, no other instance sees the slot as available, even before the process id is published.
+        auto heartbeat = slot.heartbeat.load();
+        const auto kNow = GetHeartbeatTime();
+
+        const auto kAvailable = heartbeat == 0u || kNow - heartbeat > skHeartbeatTimeout;
+
+        if (kAvailable && slot.heartbeat.compare_exchange_strong(heartbeat, kNow))
+        {
+            // lepong_top skips the slot while its values are reset.
+            slot.processId.store(0u);
+            ResetSlot(slot);
+            slot.processId.store(kProcessId);
+
+            return &slot;
+        }
+    }
+
+    return nullptr;
+}
+
+void ResetSlot(InstanceMetrics& slot) noexcept
+{
+    slot.numFrames.store(0u, std::memory_order_relaxed);
+    slot.numTicks.store(0u, std::memory_order_relaxed);
+    slot.numMatches.store(0u, std::memory_order_relaxed);
+
+    slot.playerScores[0].store(0u, std::memory_order_relaxed);
+    slot.playerScores[1].store(0u, std::memory_order_relaxed);
+
+    Time::ResetHistogram(slot.frameTimes);
+    Time::ResetHistogram(slot.tickTimes);
+}
+
+void Cleanup() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sInitialized);
+
+    if (sMapping.IsValid())
+    {
+        // The heartbeat goes last, it is what frees the slot for the next instance.
+        sInstance->processId.store(0u);
+        sInstance->heartbeat.store(0u);
+
+        FileMapping::DestroyMapping(sMapping);
+    }
+
+    sInstance = &sLocalInstance;
+    sInitialized = false;
+}
+
+void RecordFrame(std::uint64_t frameNanoseconds) noexcept
+{
+    sInstance->numFrames.fetch_add(1u, std::memory_order_relaxed);
+    sInstance->heartbeat.store(GetHeartbeatTime(), std::memory_order_relaxed);
+
+    Time::RecordValue(sInstance->frameTimes, frameNanoseconds);
+}
+
+void RecordTick(std::uint64_t tickNanoseconds) noexcept
+{
+    sInstance->numTicks.fetch_add(1u, std::memory_order_relaxed);
+    Time::RecordValue(sInstance->tickTimes, tickNanoseconds);
+}
+
+void RecordMatch() noexcept
+{
+    sInstance->numMatches.fetch_add(1u, std::memory_order_relaxed);
+}
+
+void SetScores(unsigned player1Score, unsigned player2Score) noexcept
+{
+    sInstance->playerScores[0].store(player1Score, std::memory_order_relaxed);
+    sInstance->playerScores[1].store(player2Score, std::memory_order_relaxed);
+}
+
+} // namespace lepong::Metrics
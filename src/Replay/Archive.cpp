@@ -0,0 +1,160 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cstdio>
+
+#include "lepong/Check.h"
+#include "lepong/Replay/Archive.h"
+
+namespace lepong::Replay
+{
+
+void GetSegmentPath(char* path, std::size_t size, std::uint32_t segment) noexcept
+{
+    std::snprintf(path, size, "%s/segment-%06u.bin", skArchiveDirectory, segment);
+}
+
+void GetIndexPath(char* path, std::size_t size) noexcept
+{
+    std::snprintf(path, size, "%s/index.bin", skArchiveDirectory);
+}
+
+///
+/// \return The header of the index mapped by the provided reader.
+///
+LEPONG_NODISCARD static const IndexHeader& GetIndexHeader(const ArchiveReader& reader) noexcept;
+
+///
+/// Checks that the mapped index is a complete index file.
+///
+LEPONG_NODISCARD static bool IsIndexValid(const FileMapping::Mapping& index) noexcept;
+
+ArchiveReader OpenArchive() noexcept
+{
+    char path[260];
+    GetIndexPath(path, sizeof(path));
+
+    ArchiveReader reader;
+    reader.index = FileMapping::MakeReadOnlyMapping(path);
+
+    if (!IsIndexValid(reader.index))
+    {
+        Log::Log("Failed to open the replay archive index");
+        FileMapping::DestroyMapping(reader.index);
+        return reader;
+    }
+
+    const auto& kHeader = GetIndexHeader(reader);
+
+    reader.numMatches = kHeader.numMatches;
+    reader.segments.resize(kHeader.numSegments);
+
+    return reader;
+}
+
+bool IsIndexValid(const FileMapping::Mapping& index) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(index.IsValid() && index.size >= sizeof(IndexHeader), false);
+
+    const auto& kHeader = *static_cast<const IndexHeader*>(index.data);
+    LEPONG_CHECK_OR_RETURN_VAL(kHeader.magic == skIndexMagic && kHeader.version == skIndexVersion, false);
+
+    const auto kNumBlocks = (kHeader.numMatches + skIndexBlockSize - 1) / skIndexBlockSize;
+    return index.size >= sizeof(IndexHeader) + kNumBlocks * skIndexBlockBytes;
+}
+
+void CloseArchive(ArchiveReader& reader) noexcept
+{
+    for (auto& segment : reader.segments)
+    {
+        FileMapping::DestroyMapping(segment);
+    }
+
+    reader.segments.clear();
+    reader.numMatches = 0u;
+
+    FileMapping::DestroyMapping(reader.index);
+}
+
+const IndexHeader& GetIndexHeader(const ArchiveReader& reader) noexcept
+{
+    return *static_cast<const IndexHeader*>(reader.index.data);
+}
+
+std::uint32_t GetNumMatches(const ArchiveReader& reader) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(reader.IsValid(), 0u);
+
+    return reader.numMatches;
+}
+
+std::uint32_t GetNumBlockRows(const ArchiveReader& reader, std::uint32_t block) noexcept
+{
+    const auto kNumMatches = GetNumMatches(reader);
+    const auto kFirstMatch = block * skIndexBlockSize;
+
+    LEPONG_CHECK_OR_RETURN_VAL(kFirstMatch < kNumMatches, 0u);
+
+    const auto kRemaining = kNumMatches - kFirstMatch;
+    return kRemaining < skIndexBlockSize ? kRemaining : skIndexBlockSize;
+}
+
+///
+/// Makes sure the provided range of the provided segment is mapped.
+///
+/// \return The segment's mapping, which is invalid if the range could not be mapped.
+///
+LEPONG_NODISCARD static const FileMapping::Mapping& MapSegmentRange(
+    ArchiveReader& reader, std::uint32_t segment, std::uint64_t end) noexcept;
+
+ReplayView LoadReplay(ArchiveReader& reader, std::uint32_t match) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(match < GetNumMatches(reader), ReplayView{});
+
+    const auto kSegment = GetCell<std::uint32_t>(reader, match, Column::Segment);
+    const auto kOffset = GetCell<std::uint64_t>(reader, match, Column::BlobOffset);
+    const auto kSize = GetCell<std::uint64_t>(reader, match, Column::BlobSize);
+
+    LEPONG_CHECK_OR_RETURN_VAL(kSegment < reader.segments.size() && kSize >= sizeof(BlobHeader), ReplayView{});
+
+    const auto& kMapping = MapSegmentRange(reader, kSegment, kOffset + kSize);
+    LEPONG_CHECK_OR_RETURN_VAL(kMapping.IsValid(), ReplayView{});
+
+    const auto kBlob = static_cast<const unsigned char*>(kMapping.data) + kOffset;
+    const auto kHeader = reinterpret_cast<const BlobHeader*>(kBlob);
+
+    LEPONG_CHECK_OR_RETURN_VAL(kHeader->magic == skBlobMagic, ReplayView{});
+
+    return
+    {
+        kHeader,
+        reinterpret_cast<const Record*>(kBlob + sizeof(BlobHeader)),
+        (kSize - sizeof(BlobHeader)) / sizeof(Record)
+    };
+}
+
+const FileMapping::Mapping& MapSegmentRange(ArchiveReader& reader, std::uint32_t segment, std::uint64_t end) noexcept
+{
+    auto& mapping = reader.segments[segment];
+
+    if (mapping.size < end)
+    {
+        // The segment was appended to since it was mapped, or it is not mapped yet.
+        FileMapping::DestroyMapping(mapping);
+
+        char path[260];
+        GetSegmentPath(path, sizeof(path), segment);
+
+        mapping = FileMapping::MakeReadOnlyMapping(path);
+
+        if (mapping.size < end)
+        {
+            FileMapping::DestroyMapping(mapping);
+        }
+    }
+
+    return mapping;
+}
+
+} // namespace lepong::Replay
@@ -0,0 +1,213 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <iterator>
+#include <Windows.h>
+
+#include "lepong/Check.h"
+#include "lepong/Replay/FlightRecorder.h"
+
+namespace lepong::FlightRecorder
+{
+
+static_assert((skMaxRecords & (skMaxRecords - 1u)) == 0u, "Ring sizes must be powers of two");
+static_assert((skMaxFrameTimes & (skMaxFrameTimes - 1u)) == 0u, "Ring sizes must be powers of two");
+
+static bool sInitialized = false;
+
+// The rings are only written by the main thread.
+// Counts are published after the slot they cover is written, so a crash handler never reads a torn slot.
+static Replay::Record sRecords[skMaxRecords];
+static Snapshot sSnapshots[skMaxSnapshots];
+static std::uint64_t sFrameTimes[skMaxFrameTimes];
+
+static std::atomic<std::uint64_t> sNumRecords = 0u;
+static std::atomic<std::uint64_t> sNumSnapshots = 0u;
+static std::atomic<std::uint64_t> sNumFrameTimes = 0u;
+
+static std::uint32_t sSeed = 0u;
+static std::uint64_t sNumTicks = 0u;
+
+static std::atomic<bool> sDumped = false;
+
+static LPTOP_LEVEL_EXCEPTION_FILTER sPreviousExceptionFilter = nullptr;
+
+// The fatal signals, they are raised by abort() and by the C runtime on faults.
+static constexpr int skFatalSignals[] = { SIGABRT, SIGSEGV, SIGILL, SIGFPE };
+
+static void (*sPreviousSignalHandlers[std::size(skFatalSignals)])(int) = {};
+
+///
+/// Dumps the recorder then lets the previous filter or the OS handle the exception.
+///
+static LONG WINAPI OnUnhandledException(EXCEPTION_POINTERS* exception) noexcept;
+
+///
+/// Dumps the recorder then raises the signal again with the default handler.
+///
+static void OnFatalSignal(int signal) noexcept;
+
+bool Init() noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(!sInitialized, false);
+
+    sPreviousExceptionFilter = SetUnhandledExceptionFilter(OnUnhandledException);
+
+    for (std::size_t i = 0; i < std::size(skFatalSignals); ++i)
+    {
+        sPreviousSignalHandlers[i] = std::signal(skFatalSignals[i], OnFatalSignal);
+    }
+
+    sInitialized = true;
+    return true;
+}
+
+void Cleanup() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sInitialized);
+
+    for (std::size_t i = 0; i < std::size(skFatalSignals); ++i)
+    {
+        std::signal(skFatalSignals[i], sPreviousSignalHandlers[i]);
+    }
+
+    SetUnhandledExceptionFilter(sPreviousExceptionFilter);
+    sInitialized = false;
+}
+
+void BeginMatch(std::uint32_t seed) noexcept
+{
+    sSeed = seed;
+    sNumTicks = 0u;
+
+    sNumRecords.store(0u, std::memory_order_release);
+    sNumSnapshots.store(0u, std::memory_order_release);
+    sNumFrameTimes.store(0u, std::memory_order_release);
+}
+
+///
+/// Appends a record to the record ring.
+///
+static void PushRecord(const Replay::Record& record) noexcept
+{
+    const auto kIndex = sNumRecords.load(std::memory_order_relaxed);
+
+    sRecords[kIndex & (skMaxRecords - 1u)] = record;
+    sNumRecords.store(kIndex + 1u, std::memory_order_release);
+}
+
+void RecordKeyEvent(int key, bool pressed) noexcept
+{
+    Replay::Record record;
+    record.type = Replay::RecordType::KeyEvent;
+    record.key = key;
+    record.pressed = pressed;
+
+    PushRecord(record);
+}
+
+void RecordTick(float delta, std::uint64_t stateHash, const State& state) noexcept
+{
+    Replay::Record record;
+    record.delta = delta;
+    record.stateHash = stateHash;
+
+    PushRecord(record);
+
+    if (sNumTicks++ % skSnapshotPeriod == 0u)
+    {
+        const auto kIndex = sNumSnapshots.load(std::memory_order_relaxed);
+        auto& snapshot = sSnapshots[kIndex % skMaxSnapshots];
+
+        snapshot.tick = sNumTicks;
+        snapshot.record = sNumRecords.load(std::memory_order_relaxed);
+        snapshot.state = state;
+
+        sNumSnapshots.store(kIndex + 1u, std::memory_order_release);
+    }
+}
+
+void RecordFrameTime(std::uint64_t nanoseconds) noexcept
+{
+    const auto kIndex = sNumFrameTimes.load(std::memory_order_relaxed);
+
+    sFrameTimes[kIndex & (skMaxFrameTimes - 1u)] = nanoseconds;
+    sNumFrameTimes.store(kIndex + 1u, std::memory_order_release);
+}
+
+///
+/// Writes the provided bytes to the provided file.
+///
+static void WriteBytes(HANDLE file, const void* data, std::size_t size) noexcept;
+
+///
+/// Writes the last <i>count</i> elements of a ring, from oldest to newest.
+///
+template<typename T, std::size_t Capacity>
+static void WriteRing(HANDLE file, const T (&ring)[Capacity], std::uint64_t total, std::uint32_t count) noexcept
+{
+    const auto kStart = static_cast<std::size_t>((total - count) % Capacity);
+    const auto kFirstPart = std::min<std::size_t>(count, Capacity - kStart);
+
+    WriteBytes(file, ring + kStart, kFirstPart * sizeof(T));
+    WriteBytes(file, ring, (count - kFirstPart) * sizeof(T));
+}
+
+void Dump(std::uint32_t reason) noexcept
+{
+    // Only the first crash is interesting, the handlers can run again while dumping.
+    LEPONG_CHECK_OR_RETURN(!sDumped.exchange(true));
+
+    const auto kFile = CreateFileA(
+        skDumpPath, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    LEPONG_CHECK_OR_RETURN(kFile != INVALID_HANDLE_VALUE);
+
+    const auto kNumRecords = sNumRecords.load(std::memory_order_acquire);
+    const auto kNumSnapshots = sNumSnapshots.load(std::memory_order_acquire);
+    const auto kNumFrameTimes = sNumFrameTimes.load(std::memory_order_acquire);
+
+    DumpHeader header;
+    header.magic = skDumpMagic;
+    header.version = skDumpVersion;
+    header.seed = sSeed;
+    header.reason = reason;
+    header.numRecords = static_cast<std::uint32_t>(std::min<std::uint64_t>(kNumRecords, skMaxRecords));
+    header.firstRecord = kNumRecords - header.numRecords;
+    header.numSnapshots = static_cast<std::uint32_t>(std::min<std::uint64_t>(kNumSnapshots, skMaxSnapshots));
+    header.numFrameTimes = static_cast<std::uint32_t>(std::min<std::uint64_t>(kNumFrameTimes, skMaxFrameTimes));
+
+    WriteBytes(kFile, &header, sizeof(header));
+    WriteRing(kFile, sSnapshots, kNumSnapshots, header.numSnapshots);
+    WriteRing(kFile, sRecords, kNumRecords, header.numRecords);
+    WriteRing(kFile, sFrameTimes, kNumFrameTimes, header.numFrameTimes);
+
+    CloseHandle(kFile);
+}
+
+void WriteBytes(HANDLE file, const void* data, std::size_t size) noexcept
+{
+    DWORD written;
+    WriteFile(file, data, static_cast<DWORD>(size), &written, nullptr);
+}
+
+LONG WINAPI OnUnhandledException(EXCEPTION_POINTERS* exception) noexcept
+{
+    Dump(static_cast<std::uint32_t>(exception->ExceptionRecord->ExceptionCode));
+
+    return sPreviousExceptionFilter ? sPreviousExceptionFilter(exception) : EXCEPTION_CONTINUE_SEARCH;
+}
+
+void OnFatalSignal(int signal) noexcept
+{
+    Dump(static_cast<std::uint32_t>(signal));
+
+    std::signal(signal, SIG_DFL);
+    std::raise(signal);
+}
+
+} // namespace lepong::FlightRecorder
@@ -0,0 +1,356 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <Windows.h>
+
+#include "lepong/Check.h"
+#include "lepong/Replay/InputScript.h"
+
+namespace lepong::InputScript
+{
+
+enum class EventType
+{
+    Key,
+    Quit
+};
+
+struct Event
+{
+    EventType type = EventType::Key;
+
+    // When the event is due, a time in seconds if timed, a tick otherwise.
+    bool timed = false;
+    std::uint64_t tick = 0u;
+    float time = 0.0f;
+
+    int key = 0;
+    bool pressed = false;
+
+    // The line of the file the event comes from, which orders the events due before the same tick.
+    unsigned line = 0u;
+};
+
+static bool sLoaded = false;
+static Mode sMode = Mode::RealTime;
+
+static bool sHasSeed = false;
+static std::uint32_t sSeed = 0u;
+
+// Events due at a tick and events due at a time are kept apart, each in the order they are due.
+static std::vector<Event> sTickEvents;
+static std::vector<Event> sTimedEvents;
+static std::size_t sNextTickEvent = 0u;
+static std::size_t sNextTimedEvent = 0u;
+
+// The clock of the script, the tick about to run and the game time at its end.
+static std::uint64_t sTick = 0u;
+static double sTime = 0.0;
+
+bool IsSelected() noexcept
+{
+    return GetEnvironmentVariableA(skSelectionVariable, nullptr, 0) > 1;
+}
+
+///
+/// \return The mode selected with the environment variable.
+///
+LEPONG_NODISCARD static Mode GetSelectedMode() noexcept;
+
+///
+/// Parses a line of the script into the events or the seed.
+///
+/// \return Whether the line is valid.
+///
+LEPONG_NODISCARD static bool ParseLine(char* line, unsigned lineNumber) noexcept;
+
+///
+/// Logs every event that is due before one above it in the file.
+///
+/// \return Whether the events are in order.
+///
+LEPONG_NODISCARD static bool CheckOrder(const std::vector<Event>& events) noexcept;
+
+bool Load() noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(!sLoaded, false);
+
+    char path[260] = {};
+    const auto kLength = GetEnvironmentVariableA(skSelectionVariable, path, sizeof(path));
+    LEPONG_CHECK_OR_RETURN_VAL(kLength > 0 && kLength < sizeof(path), false);
+
+    FILE* file = nullptr;
+
+    if (fopen_s(&file, path, "r") != 0)
+    {
+        Log::Log("Failed to open the input script");
+        return false;
+    }
+
+    sTickEvents.clear();
+    sTimedEvents.clear();
+    sHasSeed = false;
+
+    auto valid = true;
+    char line[256];
+
+    for (unsigned lineNumber = 1; std::fgets(line, sizeof(line), file); ++lineNumber)
+    {
+        if (!ParseLine(line, lineNumber))
+        {
+            char message[64];
+            std::snprintf(message, sizeof(message), "Invalid input script line %u", lineNumber);
+
+            Log::Log(message);
+            valid = false;
+        }
+    }
+
+    std::fclose(file);
+
+    // Both lists are checked, every event out of order is logged.
+    valid = CheckOrder(sTickEvents) && valid;
+    valid = CheckOrder(sTimedEvents) && valid;
+
+    if (valid && sTickEvents.size() + sTimedEvents.size() > skMaxEvents)
+    {
+        Log::Log("The input script has too many events");
+        valid = false;
+    }
+
+    LEPONG_CHECK_OR_RETURN_VAL(valid, false);
+
+    sMode = GetSelectedMode();
+    sNextTickEvent = 0u;
+    sNextTimedEvent = 0u;
+    sTick = 0u;
+    sTime = 0.0;
+
+    sLoaded = true;
+    return true;
+}
+
+bool CheckOrder(const std::vector<Event>& events) noexcept
+{
+    auto ordered = true;
+
+    for (std::size_t i = 1; i < events.size(); ++i)
+    {
+        const auto& kPrevious = events[i - 1u];
+        const auto& kEvent = events[i];
+
+        if (kEvent.timed ? kEvent.time < kPrevious.time : kEvent.tick < kPrevious.tick)
+        {
+            char message[96];
+
+            std::snprintf(
+                message, sizeof(message), "Input script line %u is due before line %u above it",
+                kEvent.line, kPrevious.line);
+
+            Log::Log(message);
+            ordered = false;
+        }
+    }
+
+    return ordered;
+}
+
+Mode GetSelectedMode() noexcept
+{
+    char value[8] = {};
+    GetEnvironmentVariableA(skModeVariable, value, sizeof(value));
+
+    return std::strcmp(value, "fast") == 0 ? Mode::Fast : Mode::RealTime;
+}
+
+///
+/// Parses when an event is due, either a tick or a time in seconds ending with 's'.
+///
+/// \return Whether the token is valid.
+///
+LEPONG_NODISCARD static bool ParseDue(const char* token, Event& event) noexcept;
+
+///
+/// Parses a key name, letter, digit or virtual key code.
+///
+/// \return The virtual key code, 0 if the token is not a key.
+///
+LEPONG_NODISCARD static int ParseKey(const char* token) noexcept;
+
+bool ParseLine(char* line, unsigned lineNumber) noexcept
+{
+    char first[32] = {};
+    char second[32] = {};
+    char third[32] = {};
+    char extra[2] = {};
+
+    const auto kNumTokens = std::sscanf(line, "%31s %31s %31s %1s", first, second, third, extra);
+
+    // Blank lines and comments.
+    LEPONG_CHECK_OR_RETURN_VAL(kNumTokens > 0 && first[0] != '#', true);
+
+    if (std::strcmp(first, "seed") == 0)
+    {
+        char* end = nullptr;
+        sSeed = static_cast<std::uint32_t>(std::strtoul(second, &end, 0));
+        sHasSeed = true;
+
+        return kNumTokens == 2 && end != second && *end == '\0';
+    }
+
+    Event event;
+    event.line = lineNumber;
+    LEPONG_CHECK_OR_RETURN_VAL(ParseDue(first, event), false);
+
+    if (kNumTokens == 2 && std::strcmp(second, "quit") == 0)
+    {
+        event.type = EventType::Quit;
+    }
+    else
+    {
+        LEPONG_CHECK_OR_RETURN_VAL(kNumTokens == 3, false);
+
+        event.key = ParseKey(second);
+        LEPONG_CHECK_OR_RETURN_VAL(event.key, false);
+
+        event.pressed = std::strcmp(third, "down") == 0;
+        LEPONG_CHECK_OR_RETURN_VAL(event.pressed || std::strcmp(third, "up") == 0, false);
+    }
+
+    (event.timed ? sTimedEvents : sTickEvents).push_back(event);
+    return true;
+}
+
+bool ParseDue(const char* token, Event& event) noexcept
+{
+    char* end = nullptr;
+
+    if (std::strchr(token, 's'))
+    {
+        event.timed = true;
+        event.time = std::strtof(token, &end);
+
+        return end != token && end[0] == 's' && end[1] == '\0' && event.time >= 0.0f;
+    }
+
+    event.tick = std::strtoull(token, &end, 10);
+    return end != token && *end == '\0' && std::isdigit(static_cast<unsigned char>(token[0]));
+}
+
+struct KeyName
+{
+    const char* name;
+    int key;
+};
+
+static constexpr KeyName skKeyNames[] =
+{
+    { "SPACE", 0x20 },
+    { "LEFT", 0x25 },
+    { "UP", 0x26 },
+    { "RIGHT", 0x27 },
+    { "DOWN", 0x28 },
+    { "ESCAPE", 0x1B },
+    { "RETURN", 0x0D },
+    { "SHIFT", 0x10 },
+    { "CONTROL", 0x11 }
+};
+
+int ParseKey(const char* token) noexcept
+{
+    for (const auto& kKeyName : skKeyNames)
+    {
+        if (std::strcmp(token, kKeyName.name) == 0)
+        {
+            return kKeyName.key;
+        }
+    }
+
+    const auto kFirst = static_cast<unsigned char>(token[0]);
+
+    // Letters and digits are their own virtual key codes, letters in upper case.
+    if (token[1] == '\0' && std::isalnum(kFirst))
+    {
+        return std::toupper(kFirst);
+    }
+
+    char* end = nullptr;
+    const auto kCode = std::strtol(token, &end, 0);
+
+    return end != token && *end == '\0' && kCode > 0 && kCode < 0xFF ? static_cast<int>(kCode) : 0;
+}
+
+void Cleanup() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sLoaded);
+
+    char message[64];
+
+    std::snprintf(
+        message, sizeof(message), "Input script: fed %zu of %zu events",
+        sNextTickEvent + sNextTimedEvent, sTickEvents.size() + sTimedEvents.size());
+
+    Log::Log(message);
+
+    sTickEvents.clear();
+    sTickEvents.shrink_to_fit();
+    sTimedEvents.clear();
+    sTimedEvents.shrink_to_fit();
+
+    sLoaded = false;
+}
+
+Mode GetMode() noexcept
+{
+    return sLoaded ? sMode : Mode::RealTime;
+}
+
+std::uint32_t GetSeed(std::uint32_t fallback) noexcept
+{
+    return sLoaded && sHasSeed ? sSeed : fallback;
+}
+
+bool Feed(float delta, Window::PFNKeyCallback callback) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(sLoaded, true);
+
+    sTime += delta;
+    auto keepRunning = true;
+
+    while (keepRunning)
+    {
+        const auto kTickDue = sNextTickEvent < sTickEvents.size() && sTickEvents[sNextTickEvent].tick <= sTick;
+        const auto kTimeDue = sNextTimedEvent < sTimedEvents.size() && sTimedEvents[sNextTimedEvent].time <= sTime;
+
+        if (!kTickDue && !kTimeDue)
+        {
+            break;
+        }
+
+        // Both kinds of events can be due before this tick, the one higher in the file goes first.
+        const auto kFeedTickEvent =
+            kTickDue && (!kTimeDue || sTickEvents[sNextTickEvent].line < sTimedEvents[sNextTimedEvent].line);
+
+        const auto& kEvent = kFeedTickEvent ? sTickEvents[sNextTickEvent++] : sTimedEvents[sNextTimedEvent++];
+
+        if (kEvent.type == EventType::Quit)
+        {
+            keepRunning = false;
+        }
+        else if (callback)
+        {
+            callback(kEvent.key, kEvent.pressed);
+        }
+    }
+
+    ++sTick;
+    return keepRunning;
+}
+
+} // namespace lepong::InputScript
@@ -0,0 +1,433 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <thread>
+
+#include "lepong/Check.h"
+#include "lepong/Game/Match.h"
+#include "lepong/Math/Math.h"
+#include "lepong/Replay/Query.h"
+
+namespace lepong::Replay
+{
+
+///
+/// The selection state of every row of an index block, 1 for selected and 0 otherwise.<br>
+/// Bytes rather than bits keep the filter loops simple enough to be vectorized.
+///
+using BlockMask = std::uint8_t[skIndexBlockSize];
+
+///
+/// Clears the mask of the rows whose value doesn't pass the predicate.
+///
+static void FilterBlock(
+    const ArchiveReader& reader, std::uint32_t block, const ColumnPredicate& predicate, BlockMask& mask) noexcept;
+
+///
+/// Re-simulates the candidate matches and collects the rallies passing the predicate.
+///
+static void FindRallies(
+    ArchiveReader& reader, const RallyPredicate& predicate, QueryResult& result) noexcept;
+
+QueryResult RunQuery(ArchiveReader& reader, const Query& query) noexcept
+{
+    QueryResult result;
+    LEPONG_CHECK_OR_RETURN_VAL(reader.IsValid(), result);
+
+    auto predicates = query.columnPredicates;
+
+    if (query.findRallies && query.rallyPredicate.minPaddleHits > 0)
+    {
+        // A rally can't have more hits than its whole match, which prunes most matches without simulating them.
+        predicates.push_back({ Column::NumPaddleHits, Comparison::GreaterEqual, double(query.rallyPredicate.minPaddleHits) });
+    }
+
+    const auto kNumMatches = GetNumMatches(reader);
+    const auto kNumBlocks = (kNumMatches + skIndexBlockSize - 1) / skIndexBlockSize;
+
+    for (std::uint32_t block = 0; block < kNumBlocks; ++block)
+    {
+        BlockMask mask;
+        std::fill(std::begin(mask), std::end(mask), std::uint8_t{ 1 });
+
+        for (const auto& kPredicate : predicates)
+        {
+            FilterBlock(reader, block, kPredicate, mask);
+        }
+
+        const auto kNumRows = GetNumBlockRows(reader, block);
+
+        for (std::uint32_t row = 0; row < kNumRows; ++row)
+        {
+            if (mask[row])
+            {
+                result.matches.push_back(block * skIndexBlockSize + row);
+            }
+        }
+    }
+
+    if (query.findRallies)
+    {
+        FindRallies(reader, query.rallyPredicate, result);
+    }
+
+    return result;
+}
+
+///
+/// Filters a single column slice with a fixed comparison.<br>
+/// The loop has no branches so the compiler turns it into vector compares and ands.
+///
+template<typename T, Comparison Compare>
+static void FilterValues(const T* values, T value, std::uint32_t count, BlockMask& mask) noexcept
+{
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        bool passes;
+
+        if constexpr (Compare == Comparison::Less)              passes = values[i] < value;
+        else if constexpr (Compare == Comparison::LessEqual)    passes = values[i] <= value;
+        else if constexpr (Compare == Comparison::Equal)        passes = values[i] == value;
+        else if constexpr (Compare == Comparison::NotEqual)     passes = values[i] != value;
+        else if constexpr (Compare == Comparison::GreaterEqual) passes = values[i] >= value;
+        else                                                    passes = values[i] > value;
+
+        mask[i] &= static_cast<std::uint8_t>(passes);
+    }
+}
+
+///
+/// Converts the predicate's value to the column's type without changing the outcome of any row.<br>
+/// The outcome is the same for every row when the value is not a number, is outside of the type's range, or has a
+/// fraction and is compared for equality with an integer column.
+///
+/// \return Whether the outcome depends on the row's value. If not, passes is set to the outcome of every row.
+///
+template<typename T>
+LEPONG_NODISCARD static bool ConvertPredicate(
+    const ColumnPredicate& predicate, Comparison& comparison, T& value, bool& passes) noexcept
+{
+    using Limits = std::numeric_limits<T>;
+
+    comparison = predicate.comparison;
+    auto bound = predicate.value;
+
+    if (std::isnan(bound))
+    {
+        passes = comparison == Comparison::NotEqual;
+        return false;
+    }
+
+    if constexpr (Limits::is_integer)
+    {
+        // Integers are compared with the integer closest to the value on the side of the comparison.
+        if (bound != std::floor(bound))
+        {
+            switch (comparison)
+            {
+            case Comparison::Less:
+            case Comparison::LessEqual:
+                comparison = Comparison::LessEqual;
+                bound = std::floor(bound);
+                break;
+
+            case Comparison::GreaterEqual:
+            case Comparison::Greater:
+                comparison = Comparison::GreaterEqual;
+                bound = std::ceil(bound);
+                break;
+
+            default:
+                passes = comparison == Comparison::NotEqual;
+                return false;
+            }
+        }
+    }
+
+    if (bound < double(Limits::lowest()))
+    {
+        passes = comparison == Comparison::NotEqual ||
+            comparison == Comparison::GreaterEqual || comparison == Comparison::Greater;
+
+        return false;
+    }
+
+    // The largest integer converts to a power of two that is already out of range.
+    const auto kAbove = Limits::is_integer ? bound >= std::ldexp(1.0, Limits::digits) : bound > double(Limits::max());
+
+    if (kAbove)
+    {
+        passes = comparison == Comparison::NotEqual ||
+            comparison == Comparison::LessEqual || comparison == Comparison::Less;
+
+        return false;
+    }
+
+    value = static_cast<T>(bound);
+    return true;
+}
+
+///
+/// Picks the filter loop corresponding to the predicate's comparison.
+///
+template<typename T>
+static void FilterColumn(
+    const ArchiveReader& reader, std::uint32_t block, const ColumnPredicate& predicate, BlockMask& mask) noexcept
+{
+    const auto kCount = GetNumBlockRows(reader, block);
+
+    auto comparison = predicate.comparison;
+    auto value = T{};
+    auto passes = true;
+
+    if (!ConvertPredicate(predicate, comparison, value, passes))
+    {
+        if (!passes)
+        {
+            std::fill(mask, mask + kCount, std::uint8_t{ 0 });
+        }
+
+        return;
+    }
+
+    const auto kValues = GetColumn<T>(reader, block, predicate.column);
+    LEPONG_CHECK_OR_RETURN(kValues);
+
+    switch (comparison)
+    {
+    case Comparison::Less:
+        FilterValues<T, Comparison::Less>(kValues, value, kCount, mask);
+        break;
+
+    case Comparison::LessEqual:
+        FilterValues<T, Comparison::LessEqual>(kValues, value, kCount, mask);
+        break;
+
+    case Comparison::Equal:
+        FilterValues<T, Comparison::Equal>(kValues, value, kCount, mask);
+        break;
+
+    case Comparison::NotEqual:
+        FilterValues<T, Comparison::NotEqual>(kValues, value, kCount, mask);
+        break;
+
+    case Comparison::GreaterEqual:
+        FilterValues<T, Comparison::GreaterEqual>(kValues, value, kCount, mask);
+        break;
+
+    case Comparison::Greater:
+        FilterValues<T, Comparison::Greater>(kValues, value, kCount, mask);
+        break;
+    }
+}
+
+void FilterBlock(
+    const ArchiveReader& reader, std::uint32_t block, const ColumnPredicate& predicate, BlockMask& mask) noexcept
+{
+    if (predicate.column == Column::Duration)
+    {
+        FilterColumn<float>(reader, block, predicate, mask);
+    }
+    else if (skColumnWidths[static_cast<unsigned>(predicate.column)] == sizeof(std::uint64_t))
+    {
+        FilterColumn<std::uint64_t>(reader, block, predicate, mask);
+    }
+    else
+    {
+        FilterColumn<std::uint32_t>(reader, block, predicate, mask);
+    }
+}
+
+///
+/// Collects the rallies of a single match while it is being simulated.
+///
+struct RallySearch
+{
+    std::uint32_t match = 0u;
+
+    const RallyPredicate* predicate = nullptr;
+    std::vector<RallyResult>* rallies = nullptr;
+};
+
+///
+/// A replayed match whose simulation didn't reproduce its recorded state hashes.
+///
+struct Divergence
+{
+    std::uint32_t match = 0u;
+    std::uint64_t tick = 0u;
+};
+
+///
+/// Re-simulates the provided replay, notifying the listener of the match events.
+///
+/// \param divergedTick Set to the first tick that didn't reproduce its recorded state hash, if any.
+///
+/// \return Whether every tick reproduced its recorded state hash.
+///
+LEPONG_NODISCARD static bool SimulateReplay(
+    const ReplayView& replay, const MatchListener& listener, std::uint64_t& divergedTick) noexcept;
+
+///
+/// The rally search's match listener callback.
+///
+static void OnRallyPoint(void* user, const Match& match, Side lostSide) noexcept;
+
+void FindRallies(ArchiveReader& reader, const RallyPredicate& predicate, QueryResult& result) noexcept
+{
+    const auto kNumCandidates = result.matches.size();
+    std::vector<ReplayView> replays(kNumCandidates);
+
+    // Loading is done here because the reader is not thread safe. Going backwards means each segment is first
+    // mapped for its furthest replay, so it is never remapped and no view is invalidated.
+    for (auto i = kNumCandidates; i-- > 0;)
+    {
+        replays[i] = LoadReplay(reader, result.matches[i]);
+    }
+
+    const auto kNumThreads = std::max(1u, std::min(std::thread::hardware_concurrency(), unsigned(kNumCandidates)));
+
+    std::vector<std::vector<RallyResult>> threadRallies(kNumThreads);
+
+    // The log is not thread safe, divergences are logged once the threads are joined.
+    std::vector<std::vector<Divergence>> threadDivergences(kNumThreads);
+
+    std::atomic<std::size_t> nextCandidate = 0;
+    std::atomic<std::uint32_t> numDesyncedMatches = 0u;
+
+    const auto kWork = [&](unsigned thread)
+    {
+        RallySearch search;
+        search.predicate = &predicate;
+        search.rallies = &threadRallies[thread];
+
+        MatchListener listener;
+        listener.user = &search;
+        listener.onPoint = OnRallyPoint;
+
+        for (auto i = nextCandidate++; i < kNumCandidates; i = nextCandidate++)
+        {
+            search.match = result.matches[i];
+            std::uint64_t divergedTick = 0u;
+
+            if (SimulateReplay(replays[i], listener, divergedTick))
+            {
+                continue;
+            }
+
+            ++numDesyncedMatches;
+
+            // Replays that couldn't be loaded have nothing to report.
+            if (replays[i].IsValid())
+            {
+                threadDivergences[thread].push_back({ search.match, divergedTick });
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+
+    for (unsigned thread = 1; thread < kNumThreads; ++thread)
+    {
+        threads.emplace_back(kWork, thread);
+    }
+
+    kWork(0);
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const auto& kRallies : threadRallies)
+    {
+        result.rallies.insert(result.rallies.end(), kRallies.begin(), kRallies.end());
+    }
+
+    // In match order, whichever thread simulated them.
+    std::vector<Divergence> divergences;
+
+    for (const auto& kDivergences : threadDivergences)
+    {
+        divergences.insert(divergences.end(), kDivergences.begin(), kDivergences.end());
+    }
+
+    std::sort(divergences.begin(), divergences.end(), [](const Divergence& a, const Divergence& b)
+    {
+        return a.match < b.match;
+    });
+
+    for (const auto& kDivergence : divergences)
+    {
+        char message[96];
+        std::snprintf(
+            message, sizeof(message), "Replay of match %u diverged at tick %llu",
+            kDivergence.match, static_cast<unsigned long long>(kDivergence.tick));
+
+        Log::Log(message);
+    }
+
+    std::sort(result.rallies.begin(), result.rallies.end(), [](const RallyResult& a, const RallyResult& b)
+    {
+        return a.match != b.match ? a.match < b.match : a.rally < b.rally;
+    });
+
+    result.numDesyncedMatches = numDesyncedMatches;
+}
+
+bool SimulateReplay(const ReplayView& replay, const MatchListener& listener, std::uint64_t& divergedTick) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(replay.IsValid(), false);
+
+    auto simulation = MakeHeadlessMatch();
+    simulation.listener = listener;
+
+    // Same order as the game.
+    SeedRandom(replay.header->seed);
+    simulation.Start();
+
+    for (std::size_t i = 0; i < replay.numRecords; ++i)
+    {
+        const auto& kRecord = replay.records[i];
+
+        if (kRecord.type == RecordType::KeyEvent)
+        {
+            simulation.OnKeyEvent(kRecord.key, kRecord.pressed);
+            continue;
+        }
+
+        simulation.Update(kRecord.delta);
+
+        if (HashState(simulation.CaptureState()) != kRecord.stateHash)
+        {
+            divergedTick = simulation.tick;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void OnRallyPoint(void* user, const Match& match, Side lostSide) noexcept
+{
+    auto& search = *static_cast<RallySearch*>(user);
+    const auto& kPredicate = *search.predicate;
+
+    const auto kPasses =
+        match.numRallyHits >= kPredicate.minPaddleHits &&
+        (kPredicate.lostSide == Side::None || kPredicate.lostSide == lostSide);
+
+    if (kPasses)
+    {
+        // The rally that just ended is the last one launched.
+        search.rallies->push_back({ search.match, match.numRallies - 1u, match.numRallyHits, lostSide });
+    }
+}
+
+} // namespace lepong::Replay
@@ -0,0 +1,311 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cstdio>
+#include <filesystem>
+#include <system_error>
+
+#include "lepong/Check.h"
+#include "lepong/Replay/Archive.h"
+
+namespace lepong::Replay
+{
+
+static FILE* sIndex = nullptr;
+static IndexHeader sIndexHeader;
+
+static FILE* sSegment = nullptr;
+static std::uint64_t sSegmentSize = 0u;
+
+// The match being recorded.
+static bool sRecording = false;
+static std::uint32_t sSeed = 0u;
+static std::uint64_t sBlobOffset = 0u;
+static std::uint32_t sNumTicks = 0u;
+static float sDuration = 0.0f;
+
+// The records not written yet, recording one never touches the file in the middle of an update.
+static Record sPendingRecords[skMaxPendingRecords];
+static std::uint32_t sNumPendingRecords = 0u;
+
+///
+/// Opens the index file, creating it if it doesn't exist.
+///
+LEPONG_NODISCARD static bool OpenIndex() noexcept;
+
+///
+/// Opens the last segment for appending.
+///
+LEPONG_NODISCARD static bool OpenLastSegment() noexcept;
+
+///
+/// Closes all the archive files.
+///
+static void CloseFiles() noexcept;
+
+bool Init() noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(!sIndex, false);
+
+    std::error_code error;
+    std::filesystem::create_directory(skArchiveDirectory, error); // Fails harmlessly if the directory exists.
+
+    const auto kOpened = OpenIndex() && OpenLastSegment();
+
+    if (!kOpened)
+    {
+        Log::Log("Failed to open the replay archive");
+        CloseFiles();
+    }
+
+    return kOpened;
+}
+
+///
+/// Writes the index header to the index file.
+///
+static void WriteIndexHeader() noexcept;
+
+bool OpenIndex() noexcept
+{
+    char path[260];
+    GetIndexPath(path, sizeof(path));
+
+    sIndex = std::fopen(path, "r+b");
+
+    if (!sIndex)
+    {
+        sIndex = std::fopen(path, "w+b");
+        LEPONG_CHECK_OR_RETURN_VAL(sIndex, false);
+
+        sIndexHeader = {};
+        WriteIndexHeader();
+    }
+
+    std::fseek(sIndex, 0, SEEK_SET);
+    LEPONG_CHECK_OR_RETURN_VAL(std::fread(&sIndexHeader, sizeof(IndexHeader), 1, sIndex) == 1, false);
+
+    return sIndexHeader.magic == skIndexMagic && sIndexHeader.version == skIndexVersion;
+}
+
+void WriteIndexHeader() noexcept
+{
+    std::fseek(sIndex, 0, SEEK_SET);
+    std::fwrite(&sIndexHeader, sizeof(IndexHeader), 1, sIndex);
+    std::fflush(sIndex);
+}
+
+bool OpenLastSegment() noexcept
+{
+    if (sIndexHeader.numSegments == 0)
+    {
+        sIndexHeader.numSegments = 1;
+        WriteIndexHeader();
+    }
+
+    char path[260];
+    GetSegmentPath(path, sizeof(path), sIndexHeader.numSegments - 1);
+
+    sSegment = std::fopen(path, "ab");
+    LEPONG_CHECK_OR_RETURN_VAL(sSegment, false);
+
+    // Segments are capped well below 2GB so a long is enough here.
+    std::fseek(sSegment, 0, SEEK_END);
+    sSegmentSize = static_cast<std::uint64_t>(std::ftell(sSegment));
+
+    return true;
+}
+
+void CloseFiles() noexcept
+{
+    if (sSegment)
+    {
+        std::fclose(sSegment);
+        sSegment = nullptr;
+    }
+
+    if (sIndex)
+    {
+        std::fclose(sIndex);
+        sIndex = nullptr;
+    }
+}
+
+void Cleanup() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sIndex);
+
+    // An unfinished match stays in its segment but is never indexed.
+    WritePending();
+    sRecording = false;
+    CloseFiles();
+}
+
+///
+/// Starts a new segment if the current one is full.
+///
+static void RollSegmentIfFull() noexcept;
+
+///
+/// Appends the provided data to the current segment.
+///
+static void WriteToSegment(const void* data, std::size_t size) noexcept;
+
+///
+/// Adds the provided record to the pending ones.
+///
+static void AddRecord(const Record& record) noexcept;
+
+void BeginMatch(std::uint32_t seed) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sIndex && !sRecording);
+
+    RollSegmentIfFull();
+    LEPONG_CHECK_OR_RETURN(sSegment);
+
+    sRecording = true;
+    sSeed = seed;
+    sBlobOffset = sSegmentSize;
+    sNumTicks = 0u;
+    sDuration = 0.0f;
+
+    BlobHeader header;
+    header.magic = skBlobMagic;
+    header.seed = seed;
+
+    WriteToSegment(&header, sizeof(BlobHeader));
+}
+
+void RollSegmentIfFull() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sSegmentSize >= skMaxSegmentSize);
+
+    std::fclose(sSegment);
+    sSegment = nullptr;
+
+    ++sIndexHeader.numSegments;
+    WriteIndexHeader();
+
+    LEPONG_CHECK_OR_LOG(OpenLastSegment(), "Failed to open a new replay segment");
+}
+
+void WriteToSegment(const void* data, std::size_t size) noexcept
+{
+    std::fwrite(data, size, 1, sSegment);
+    sSegmentSize += size;
+}
+
+void RecordKeyEvent(int key, bool pressed) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sRecording);
+
+    Record record;
+    record.type = RecordType::KeyEvent;
+    record.key = key;
+    record.pressed = pressed;
+
+    AddRecord(record);
+}
+
+void RecordTick(float delta, std::uint64_t stateHash) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sRecording);
+
+    Record record;
+    record.type = RecordType::Tick;
+    record.delta = delta;
+    record.stateHash = stateHash;
+
+    AddRecord(record);
+
+    ++sNumTicks;
+    sDuration += delta;
+}
+
+void AddRecord(const Record& record) noexcept
+{
+    // Only happens if the records are not written every frame.
+    if (sNumPendingRecords == skMaxPendingRecords)
+    {
+        WritePending();
+    }
+
+    sPendingRecords[sNumPendingRecords++] = record;
+}
+
+void WritePending() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sNumPendingRecords);
+
+    WriteToSegment(sPendingRecords, sNumPendingRecords * sizeof(Record));
+    sNumPendingRecords = 0u;
+}
+
+///
+/// Makes room for a new block of rows at the end of the index file.
+///
+static void AppendIndexBlock() noexcept;
+
+///
+/// Writes the value of a single index cell.
+///
+template<typename T>
+static void WriteIndexCell(std::uint32_t match, Column column, T value) noexcept;
+
+void FinishMatch(const MatchSummary& summary) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sRecording);
+
+    sRecording = false;
+
+    // The blob must be on disk before the index references it.
+    WritePending();
+    std::fflush(sSegment);
+
+    const auto kMatch = sIndexHeader.numMatches;
+
+    if (kMatch % skIndexBlockSize == 0)
+    {
+        AppendIndexBlock();
+    }
+
+    WriteIndexCell(kMatch, Column::BlobOffset, sBlobOffset);
+    WriteIndexCell(kMatch, Column::BlobSize, sSegmentSize - sBlobOffset);
+    WriteIndexCell(kMatch, Column::Seed, sSeed);
+    WriteIndexCell(kMatch, Column::Segment, sIndexHeader.numSegments - 1);
+    WriteIndexCell(kMatch, Column::NumTicks, sNumTicks);
+    WriteIndexCell(kMatch, Column::Duration, sDuration);
+    WriteIndexCell(kMatch, Column::Player1Score, summary.playerScores[0]);
+    WriteIndexCell(kMatch, Column::Player2Score, summary.playerScores[1]);
+    WriteIndexCell(kMatch, Column::NumRallies, summary.numRallies);
+    WriteIndexCell(kMatch, Column::NumPaddleHits, summary.numPaddleHits);
+
+    // Publishing the row last means readers never see a partially written one.
+    ++sIndexHeader.numMatches;
+    WriteIndexHeader();
+}
+
+void AppendIndexBlock() noexcept
+{
+    static constexpr unsigned char kZeros[4096] = {};
+
+    const auto kBlockOffset = GetIndexCellOffset(sIndexHeader.numMatches, Column::BlobOffset);
+    std::fseek(sIndex, static_cast<long>(kBlockOffset), SEEK_SET);
+
+    for (std::size_t written = 0; written < skIndexBlockBytes; written += sizeof(kZeros))
+    {
+        std::fwrite(kZeros, sizeof(kZeros), 1, sIndex);
+    }
+}
+
+template<typename T>
+void WriteIndexCell(std::uint32_t match, Column column, T value) noexcept
+{
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8);
+
+    std::fseek(sIndex, static_cast<long>(GetIndexCellOffset(match, column)), SEEK_SET);
+    std::fwrite(&value, sizeof(T), 1, sIndex);
+}
+
+} // namespace lepong::Replay
@@ -0,0 +1,166 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#if defined(_MSC_VER)
+#include <intrin.h> // For _BitScanReverse64.
+#endif
+
+#include "lepong/Time/Histogram.h"
+
+namespace lepong::Time
+{
+
+static constexpr std::uint64_t skSubBucketCount = 1ull << skHistogramSubBucketBits;
+static constexpr std::uint64_t skMaxValue = (1ull << skHistogramMaxValueBits) - 1u;
+
+///
+/// \return The index of the highest set bit of the provided non zero value.
+///
+LEPONG_NODISCARD static unsigned GetHighestBit(std::uint64_t value) noexcept
+{
+#if defined(_MSC_VER)
+    unsigned long bit;
+    _BitScanReverse64(&bit, value);
+    return static_cast<unsigned>(bit);
+#else
+    return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#endif
+}
+
+///
+/// \return The index of the bucket the provided value belongs to.
+///
+LEPONG_NODISCARD static unsigned GetBucketIndex(std::uint64_t value) noexcept
+{
+    if (value < skSubBucketCount)
+    {
+        return static_cast<unsigned>(value);
+    }
+
+    // The top bits of the value select the sub bucket, the rest is precision we don't keep.
+    const auto kShift = GetHighestBit(value) - skHistogramSubBucketBits;
+    return static_cast<unsigned>((kShift << skHistogramSubBucketBits) + (value >> kShift));
+}
+
+///
+/// \return The highest value that belongs to the provided bucket.
+///
+LEPONG_NODISCARD static std::uint64_t GetBucketHighestValue(unsigned index) noexcept
+{
+    if (index < skSubBucketCount)
+    {
+        return index;
+    }
+
+    const auto kShift = (index >> skHistogramSubBucketBits) - 1u;
+    const std::uint64_t kTop = index - (kShift << skHistogramSubBucketBits);
+
+    return ((kTop + 1u) << kShift) - 1u;
+}
+
+///
+/// Atomically lowers or raises the provided value.
+///
+template<bool Lower>
+static void UpdateBound(std::atomic<std::uint64_t>& bound, std::uint64_t value) noexcept
+{
+    auto current = bound.load(std::memory_order_relaxed);
+
+    while (Lower ? value < current : value > current)
+    {
+        if (bound.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {
+            break;
+        }
+    }
+}
+
+void RecordValue(Histogram& histogram, std::uint64_t value) noexcept
+{
+    value = value < skMaxValue ? value : skMaxValue;
+
+    histogram.counts[GetBucketIndex(value)].fetch_add(1u, std::memory_order_relaxed);
+
+    histogram.totalCount.fetch_add(1u, std::memory_order_relaxed);
+    histogram.sum.fetch_add(value, std::memory_order_relaxed);
+
+    UpdateBound<true>(histogram.min, value);
+    UpdateBound<false>(histogram.max, value);
+}
+
+void MergeHistogram(Histogram& into, const Histogram& from) noexcept
+{
+    for (unsigned i = 0; i < skNumHistogramBuckets; ++i)
+    {
+        const auto kCount = from.counts[i].load(std::memory_order_relaxed);
+
+        if (kCount)
+        {
+            into.counts[i].fetch_add(kCount, std::memory_order_relaxed);
+        }
+    }
+
+    into.totalCount.fetch_add(from.totalCount.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    into.sum.fetch_add(from.sum.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+    UpdateBound<true>(into.min, from.min.load(std::memory_order_relaxed));
+    UpdateBound<false>(into.max, from.max.load(std::memory_order_relaxed));
+}
+
+void ResetHistogram(Histogram& histogram) noexcept
+{
+    for (auto& count : histogram.counts)
+    {
+        count.store(0u, std::memory_order_relaxed);
+    }
+
+    histogram.totalCount.store(0u, std::memory_order_relaxed);
+    histogram.sum.store(0u, std::memory_order_relaxed);
+    histogram.min.store(UINT64_MAX, std::memory_order_relaxed);
+    histogram.max.store(0u, std::memory_order_relaxed);
+}
+
+std::uint64_t GetValueAtPercentile(const Histogram& histogram, double percentile) noexcept
+{
+    const auto kTotalCount = histogram.totalCount.load(std::memory_order_relaxed);
+
+    if (kTotalCount == 0u)
+    {
+        return 0u;
+    }
+
+    percentile = percentile < 0.0 ? 0.0 : (percentile > 100.0 ? 100.0 : percentile);
+
+    auto target = static_cast<std::uint64_t>(percentile / 100.0 * static_cast<double>(kTotalCount) + 0.5);
+    target = target ? target : 1u;
+
+    std::uint64_t cumulativeCount = 0u;
+
+    for (unsigned i = 0; i < skNumHistogramBuckets; ++i)
+    {
+        cumulativeCount += histogram.counts[i].load(std::memory_order_relaxed);
+
+        if (cumulativeCount >= target)
+        {
+            // Don't report more than what was actually recorded.
+            const auto kValue = GetBucketHighestValue(i);
+            const auto kMax = histogram.max.load(std::memory_order_relaxed);
+
+            return kValue < kMax ? kValue : kMax;
+        }
+    }
+
+    return histogram.max.load(std::memory_order_relaxed);
+}
+
+double GetMean(const Histogram& histogram) noexcept
+{
+    const auto kTotalCount = histogram.totalCount.load(std::memory_order_relaxed);
+
+    return kTotalCount
+        ? static_cast<double>(histogram.sum.load(std::memory_order_relaxed)) / static_cast<double>(kTotalCount)
+        : 0.0;
+}
+
+} // namespace lepong::Time
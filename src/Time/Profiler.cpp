@@ -0,0 +1,157 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cstdio>
+
+#include "lepong/Check.h"
+#include "lepong/Time/Profiler.h"
+#include "lepong/Time/Time.h"
+
+namespace lepong::Profiler
+{
+
+static constexpr auto skNumTimers = static_cast<unsigned>(Timer::Count);
+
+static constexpr const char* skTimerNames[] =
+{
+    "frame",
+    "update",
+    "runahead",
+    "render",
+    "swap",
+    "gpu",
+    "gpu.clear",
+    "gpu.post",
+    "gpu.ball",
+    "gpu.paddles",
+    "gpu.scene",
+    "gpu.upscale",
+    "gpu.swap"
+};
+
+static_assert(sizeof(skTimerNames) / sizeof(skTimerNames[0]) == skNumTimers);
+
+static constexpr std::uint64_t skDumpPeriod = 10'000'000'000u; // 10 seconds.
+
+static FILE* sStats = nullptr;
+
+static Time::Histogram sHistograms[skNumTimers];
+
+static std::uint64_t sLastFrameEnd = 0u;
+static std::uint64_t sLastDump = 0u;
+
+bool Init() noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(!sStats, false);
+
+    const auto kOpened = !fopen_s(&sStats, "lepong.stats", "w");
+    LEPONG_CHECK_OR_LOG(kOpened, "Failed to open the stats file");
+    LEPONG_CHECK_OR_RETURN_VAL(kOpened, false);
+
+    // Values are in microseconds.
+    std::fputs("time,timer,count,min,mean,p50,p90,p99,p99.9,max\n", sStats);
+
+    sLastFrameEnd = Time::GetNanoseconds();
+    sLastDump = sLastFrameEnd;
+
+    return true;
+}
+
+///
+/// Writes the histograms to the log and the stats file then clears them.
+///
+static void Dump(std::uint64_t now) noexcept;
+
+void Cleanup() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sStats);
+
+    Dump(Time::GetNanoseconds());
+
+    std::fclose(sStats);
+    sStats = nullptr;
+}
+
+void Record(Timer timer, std::uint64_t nanoseconds) noexcept
+{
+    Time::RecordValue(sHistograms[static_cast<unsigned>(timer)], nanoseconds);
+}
+
+std::uint64_t OnFrameEnd() noexcept
+{
+    const auto kNow = Time::GetNanoseconds();
+    const auto kFrameTime = kNow - sLastFrameEnd;
+
+    Record(Timer::Frame, kFrameTime);
+    sLastFrameEnd = kNow;
+
+    if (kNow - sLastDump >= skDumpPeriod)
+    {
+        Dump(kNow);
+    }
+
+    return kFrameTime;
+}
+
+const Time::Histogram& GetHistogram(Timer timer) noexcept
+{
+    return sHistograms[static_cast<unsigned>(timer)];
+}
+
+///
+/// Writes a single histogram to the log and the stats file.
+///
+static void DumpHistogram(double time, const char* name, const Time::Histogram& histogram) noexcept;
+
+void Dump(std::uint64_t now) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sStats);
+
+    sLastDump = now;
+    const auto kTime = static_cast<double>(now) / 1e9;
+
+    for (unsigned i = 0; i < skNumTimers; ++i)
+    {
+        DumpHistogram(kTime, skTimerNames[i], sHistograms[i]);
+        Time::ResetHistogram(sHistograms[i]);
+    }
+
+    std::fflush(sStats);
+}
+
+void DumpHistogram(double time, const char* name, const Time::Histogram& histogram) noexcept
+{
+    const auto kCount = histogram.totalCount.load(std::memory_order_relaxed);
+    LEPONG_CHECK_OR_RETURN(kCount);
+
+    const auto kToMicroseconds = [](std::uint64_t nanoseconds) { return static_cast<double>(nanoseconds) / 1e3; };
+
+    const double kValues[] =
+    {
+        kToMicroseconds(histogram.min.load(std::memory_order_relaxed)),
+        Time::GetMean(histogram) / 1e3,
+        kToMicroseconds(Time::GetValueAtPercentile(histogram, 50.0)),
+        kToMicroseconds(Time::GetValueAtPercentile(histogram, 90.0)),
+        kToMicroseconds(Time::GetValueAtPercentile(histogram, 99.0)),
+        kToMicroseconds(Time::GetValueAtPercentile(histogram, 99.9)),
+        kToMicroseconds(histogram.max.load(std::memory_order_relaxed))
+    };
+
+    std::fprintf(
+        sStats, "%.3f,%s,%llu,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f\n",
+        time, name, static_cast<unsigned long long>(kCount),
+        kValues[0], kValues[1], kValues[2], kValues[3], kValues[4], kValues[5], kValues[6]);
+
+    char message[192];
+
+    std::snprintf(
+        message, sizeof(message),
+        "%-11s n=%llu min=%.1fus mean=%.1fus p50=%.1fus p90=%.1fus p99=%.1fus p99.9=%.1fus max=%.1fus",
+        name, static_cast<unsigned long long>(kCount),
+        kValues[0], kValues[1], kValues[2], kValues[3], kValues[4], kValues[5], kValues[6]);
+
+    Log::Log(message);
+}
+
+} // namespace lepong::Profiler
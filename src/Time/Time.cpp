@@ -45,4 +45,22 @@ float Get() noexcept
     return static_cast<float>(kTickDelta) / sPerformanceFrequency.QuadPart;
 }
 
+std::uint64_t GetNanoseconds() noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(sInitialized, 0u);
+
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+
+    const auto kTickDelta = static_cast<std::uint64_t>(now.QuadPart - sInitTimestamp.QuadPart);
+    const auto kFrequency = static_cast<std::uint64_t>(sPerformanceFrequency.QuadPart);
+
+    // Whole seconds and the remainder are converted separately so the multiplication can't overflow.
+    constexpr std::uint64_t kNanosecondsPerSecond = 1000000000u;
+
+    return
+        (kTickDelta / kFrequency) * kNanosecondsPerSecond +
+        (kTickDelta % kFrequency) * kNanosecondsPerSecond / kFrequency;
+}
+
 } // namespace lepong::Time
@@ -18,10 +18,17 @@ static auto sModule = GetModuleHandleW(nullptr); // NOLINT: Clang-Tidy thinks Ge
 ///
 LEPONG_NODISCARD static bool RegisterWindowClass() noexcept;
 
+///
+/// Makes the process per monitor DPI aware where supported, system DPI aware otherwise.
+///
+static void EnableDpiAwareness() noexcept;
+
 bool Init() noexcept
 {
     LEPONG_CHECK_OR_RETURN_VAL(!sInitialized, false);
 
+    EnableDpiAwareness();
+
     sInitialized = RegisterWindowClass();
     LEPONG_CHECK_OR_LOG(sInitialized, "Failed to register window class");
 
@@ -46,7 +53,25 @@ static bool RegisterWindowClass() noexcept
     return RegisterClassW(&windowClass);
 }
 
+void EnableDpiAwareness() noexcept
+{
+    // Only available since Windows 10, loaded at runtime.
+    using PFNSetProcessDpiAwarenessContext = BOOL (WINAPI*)(HANDLE);
+
+    const auto kSetProcessDpiAwarenessContext = reinterpret_cast<PFNSetProcessDpiAwarenessContext>(
+        GetProcAddress(GetModuleHandleW(L"user32.dll"), "SetProcessDpiAwarenessContext"));
+
+    // DPI_AWARENESS_CONTEXT_PER_MONITOR_AWARE_V2.
+    const auto kPerMonitorAwareV2 = reinterpret_cast<HANDLE>(static_cast<INT_PTR>(-4));
+
+    if (!kSetProcessDpiAwarenessContext || !kSetProcessDpiAwarenessContext(kPerMonitorAwareV2))
+    {
+        SetProcessDPIAware();
+    }
+}
+
 static PFNKeyCallback sKeyCallback = nullptr;
+static PFNResizeCallback sResizeCallback = nullptr;
 
 LRESULT CALLBACK OnMessage(HWND window, UINT message, WPARAM wParam, LPARAM lParam) noexcept
 {
@@ -81,6 +106,31 @@ LRESULT CALLBACK OnMessage(HWND window, UINT message, WPARAM wParam, LPARAM lPar
         break;
     }
 
+    case WM_SIZE:
+    {
+        if (sResizeCallback && wParam != SIZE_MINIMIZED)
+        {
+            sResizeCallback({ LOWORD(lParam), HIWORD(lParam) });
+            return 0;
+        }
+
+        break;
+    }
+
+    case WM_DPICHANGED:
+    {
+        // The suggested area keeps the window the same physical size on the new monitor, this sends WM_SIZE.
+        const auto& kArea = *reinterpret_cast<const RECT*>(lParam);
+
+        SetWindowPos(
+            window, nullptr,
+            kArea.left, kArea.top,
+            kArea.right - kArea.left, kArea.bottom - kArea.top,
+            SWP_NOZORDER | SWP_NOACTIVATE);
+
+        return 0;
+    }
+
     default: break;
     }
 
@@ -92,6 +142,11 @@ void SetKeyCallback(PFNKeyCallback callback) noexcept
     sKeyCallback = callback;
 }
 
+void SetResizeCallback(PFNResizeCallback callback) noexcept
+{
+    sResizeCallback = callback;
+}
+
 void Cleanup() noexcept
 {
     LEPONG_CHECK_OR_RETURN(sInitialized);
@@ -100,6 +155,11 @@ void Cleanup() noexcept
     sInitialized = false;
 }
 
+///
+/// Scales a size in pixels at 96 DPI to the screen's DPI.
+///
+LEPONG_NODISCARD static Vector2i ScaleToScreenDpi(const Vector2i& size) noexcept;
+
 ///
 /// Calculates the dimensions of the client area based on the provided size.<br>
 /// The resulting client area is centered on the screen.
@@ -110,7 +170,7 @@ HWND MakeWindow(const Vector2i& size, const wchar_t* title) noexcept
 {
     LEPONG_CHECK_OR_RETURN_VAL(sInitialized, nullptr);
 
-    const auto kArea = CenterClientArea(size);
+    const auto kArea = CenterClientArea(ScaleToScreenDpi(size));
 
     const Vector2i kSize =
     {
@@ -133,6 +193,19 @@ HWND MakeWindow(const Vector2i& size, const wchar_t* title) noexcept
 ///
 LEPONG_NODISCARD static Vector2i AdjustAreaSize(const Vector2i& size) noexcept;
 
+Vector2i ScaleToScreenDpi(const Vector2i& size) noexcept
+{
+    const auto kScreen = GetDC(nullptr);
+    const auto kDpi = GetDeviceCaps(kScreen, LOGPIXELSX);
+    ReleaseDC(nullptr, kScreen);
+
+    return
+    {
+        MulDiv(size.x, kDpi, USER_DEFAULT_SCREEN_DPI),
+        MulDiv(size.y, kDpi, USER_DEFAULT_SCREEN_DPI)
+    };
+}
+
 RECT CenterClientArea(const Vector2i& size) noexcept
 {
     const Vector2i kScreenHalfSize =
@@ -173,6 +246,18 @@ Vector2i AdjustAreaSize(const Vector2i& size) noexcept
     };
 }
 
+Vector2i GetClientSize(HWND window) noexcept
+{
+    RECT area = {};
+    GetClientRect(window, &area);
+
+    return
+    {
+        static_cast<int>(area.right), // Left and Top are 0.
+        static_cast<int>(area.bottom)
+    };
+}
+
 void DestroyWindow(HWND window) noexcept
 {
     LEPONG_CHECK_OR_RETURN(window);
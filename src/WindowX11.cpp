@@ -0,0 +1,484 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#include "lepong/Check.h"
+#include "lepong/Window.h"
+
+#include "WindowX11.h"
+
+#include <X11/keysym.h>
+#include <X11/Xatom.h>
+#include <X11/XKBlib.h>
+#include <X11/Xresource.h>
+#include <X11/Xutil.h>
+
+namespace lepong::Window
+{
+
+// The X11 implementation of the window system, for Linux. Keys are reported with their Windows virtual key codes so
+// the game handles them the same way on every platform, the keys without one are ignored.<br>
+// A single display connection is shared by every window. Its events are only read when they are polled: polling never
+// waits for the X server and never allocates, the events are read into the stack one at a time.
+
+static Display* sDisplay = nullptr;
+
+// Sent by the window manager when the window is closed.
+static Atom sDeleteMessage = 0;
+
+// Maps the X windows to their handles, for the events that only know the former.
+static XContext sWindowContext = 0;
+
+// Whether the server sends held keys as repeated presses only, instead of release and press pairs.
+static bool sDetectableAutoRepeat = false;
+
+// Indexed by key code, X key codes are between 8 and 255.
+static bool sHeldKeys[256] = {};
+
+bool Init() noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(!sDisplay, false);
+
+    sDisplay = XOpenDisplay(nullptr);
+    LEPONG_CHECK_OR_LOG(sDisplay, "Failed to open the X display");
+    LEPONG_CHECK_OR_RETURN_VAL(sDisplay, false);
+
+    // X has no DPI awareness to enable, windows are always sized in physical pixels.
+    sDeleteMessage = XInternAtom(sDisplay, "WM_DELETE_WINDOW", False);
+    sWindowContext = XUniqueContext();
+
+    Bool supported = False;
+    XkbSetDetectableAutoRepeat(sDisplay, True, &supported);
+    sDetectableAutoRepeat = supported;
+
+    for (auto& held : sHeldKeys)
+    {
+        held = false;
+    }
+
+    return true;
+}
+
+static PFNKeyCallback sKeyCallback = nullptr;
+static PFNResizeCallback sResizeCallback = nullptr;
+
+void SetKeyCallback(PFNKeyCallback callback) noexcept
+{
+    sKeyCallback = callback;
+}
+
+void SetResizeCallback(PFNResizeCallback callback) noexcept
+{
+    sResizeCallback = callback;
+}
+
+void Cleanup() noexcept
+{
+    LEPONG_CHECK_OR_RETURN(sDisplay);
+
+    XCloseDisplay(sDisplay);
+    sDisplay = nullptr;
+}
+
+///
+/// Scales a size in pixels at 96 DPI to the screen's DPI.
+///
+LEPONG_NODISCARD static Vector2i ScaleToScreenDpi(const Vector2i& size) noexcept;
+
+///
+/// Sets the provided window's title, converted to UTF-8.
+///
+static void SetWindowTitle(HWND window, const wchar_t* title) noexcept;
+
+HWND MakeWindow(const Vector2i& size, const wchar_t* title) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(sDisplay, nullptr);
+
+    const auto kScreen = DefaultScreen(sDisplay);
+    const auto kVisual = Graphics::GL::ChooseVisual(sDisplay, kScreen);
+    LEPONG_CHECK_OR_LOG(kVisual, "No visual of the X screen supports OpenGL");
+    LEPONG_CHECK_OR_RETURN_VAL(kVisual, nullptr);
+
+    const auto kWindow = new (std::nothrow) HWND__;
+
+    if (!kWindow)
+    {
+        XFree(kVisual);
+        return nullptr;
+    }
+
+    const auto kSize = ScaleToScreenDpi(size);
+    const auto kRoot = RootWindow(sDisplay, kScreen);
+
+    const Vector2i kPosition =
+    {
+        (DisplayWidth(sDisplay, kScreen) - kSize.x) / 2,
+        (DisplayHeight(sDisplay, kScreen) - kSize.y) / 2
+    };
+
+    // OpenGL draws the whole window, the server doesn't clear it when it is exposed or resized.
+    // The border and colormap default to the root window's, which don't match a different visual.
+    XSetWindowAttributes attributes = {};
+    attributes.background_pixmap = None;
+    attributes.border_pixel = 0;
+    attributes.colormap = XCreateColormap(sDisplay, kRoot, kVisual->visual, AllocNone);
+    attributes.event_mask = KeyPressMask | KeyReleaseMask | StructureNotifyMask;
+
+    const auto kDrawable = XCreateWindow(
+        sDisplay, kRoot,
+        kPosition.x, kPosition.y,
+        static_cast<unsigned>(kSize.x), static_cast<unsigned>(kSize.y),
+        0, kVisual->depth, InputOutput, kVisual->visual,
+        CWBackPixmap | CWBorderPixel | CWColormap | CWEventMask, &attributes);
+
+    XFree(kVisual);
+
+    kWindow->device.display = sDisplay;
+    kWindow->device.drawable = kDrawable;
+    kWindow->size = kSize;
+    kWindow->colormap = attributes.colormap;
+
+    // Window managers place new windows themselves unless they are told the position was chosen.
+    XSizeHints hints = {};
+    hints.flags = PPosition | PSize;
+    XSetWMNormalHints(sDisplay, kDrawable, &hints);
+
+    XSetWMProtocols(sDisplay, kDrawable, &sDeleteMessage, 1);
+    XSaveContext(sDisplay, kDrawable, sWindowContext, reinterpret_cast<XPointer>(kWindow));
+
+    SetWindowTitle(kWindow, title);
+    return kWindow;
+}
+
+Vector2i ScaleToScreenDpi(const Vector2i& size) noexcept
+{
+    constexpr long kDefaultDpi = 96;
+
+    // Desktops store the screen's DPI in the Xft resources, X itself only knows the physical size of the screen.
+    const auto kSetting = XGetDefault(sDisplay, "Xft", "dpi");
+    const auto kDpi = kSetting ? std::strtol(kSetting, nullptr, 10) : kDefaultDpi;
+
+    LEPONG_CHECK_OR_RETURN_VAL(kDpi > 0, size);
+
+    return
+    {
+        static_cast<int>(size.x * kDpi / kDefaultDpi),
+        static_cast<int>(size.y * kDpi / kDefaultDpi)
+    };
+}
+
+///
+/// Encodes a code point to UTF-8.
+///
+/// \return The number of bytes written, at most 4.
+///
+static unsigned EncodeUtf8(std::uint32_t codePoint, unsigned char* output) noexcept;
+
+void SetWindowTitle(HWND window, const wchar_t* title) noexcept
+{
+    unsigned char name[256] = {};
+    unsigned length = 0;
+
+    // Longer titles are truncated.
+    for (auto character = title; character && *character && length + 4u < sizeof(name); ++character)
+    {
+        length += EncodeUtf8(static_cast<std::uint32_t>(*character), name + length);
+    }
+
+    const auto& kDevice = window->device;
+
+    // The old property is only read as Latin-1, ASCII titles look the same in both.
+    XStoreName(kDevice.display, kDevice.drawable, reinterpret_cast<const char*>(name));
+
+    XChangeProperty(
+        kDevice.display, kDevice.drawable,
+        XInternAtom(kDevice.display, "_NET_WM_NAME", False),
+        XInternAtom(kDevice.display, "UTF8_STRING", False),
+        8, PropModeReplace, name, static_cast<int>(length));
+}
+
+unsigned EncodeUtf8(std::uint32_t codePoint, unsigned char* output) noexcept
+{
+    if (codePoint < 0x80u)
+    {
+        output[0] = static_cast<unsigned char>(codePoint);
+        return 1u;
+    }
+
+    if (codePoint < 0x800u)
+    {
+        output[0] = static_cast<unsigned char>(0xC0u | (codePoint >> 6u));
+        output[1] = static_cast<unsigned char>(0x80u | (codePoint & 0x3Fu));
+        return 2u;
+    }
+
+    if (codePoint < 0x10000u)
+    {
+        output[0] = static_cast<unsigned char>(0xE0u | (codePoint >> 12u));
+        output[1] = static_cast<unsigned char>(0x80u | ((codePoint >> 6u) & 0x3Fu));
+        output[2] = static_cast<unsigned char>(0x80u | (codePoint & 0x3Fu));
+        return 3u;
+    }
+
+    output[0] = static_cast<unsigned char>(0xF0u | ((codePoint >> 18u) & 0x07u));
+    output[1] = static_cast<unsigned char>(0x80u | ((codePoint >> 12u) & 0x3Fu));
+    output[2] = static_cast<unsigned char>(0x80u | ((codePoint >> 6u) & 0x3Fu));
+    output[3] = static_cast<unsigned char>(0x80u | (codePoint & 0x3Fu));
+    return 4u;
+}
+
+Vector2i GetClientSize(HWND window) noexcept
+{
+    XWindowAttributes attributes = {};
+    XGetWindowAttributes(window->device.display, window->device.drawable, &attributes);
+
+    return
+    {
+        attributes.width,
+        attributes.height
+    };
+}
+
+void DestroyWindow(HWND window) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(window);
+
+    const auto& kDevice = window->device;
+
+    XDeleteContext(kDevice.display, kDevice.drawable, sWindowContext);
+    XDestroyWindow(kDevice.display, kDevice.drawable);
+    XFreeColormap(kDevice.display, window->colormap);
+
+    delete window;
+}
+
+void SetWindowResizable(HWND window, bool resizable) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(window);
+
+    XSizeHints hints = {};
+
+    if (!resizable)
+    {
+        // Window managers don't let the user resize a window whose minimum and maximum sizes are the same.
+        const auto kSize = GetClientSize(window);
+
+        hints.flags = PMinSize | PMaxSize;
+        hints.min_width = hints.max_width = kSize.x;
+        hints.min_height = hints.max_height = kSize.y;
+    }
+
+    XSetWMNormalHints(window->device.display, window->device.drawable, &hints);
+}
+
+///
+/// Sets the provided window's visible state.
+///
+static void SetWindowVisible(HWND window, bool visible) noexcept;
+
+void ShowWindow(HWND window) noexcept
+{
+    SetWindowVisible(window, true);
+}
+
+void SetWindowVisible(HWND window, bool visible) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(window);
+
+    const auto& kDevice = window->device;
+
+    if (visible)
+    {
+        XMapWindow(kDevice.display, kDevice.drawable);
+    }
+    else
+    {
+        XUnmapWindow(kDevice.display, kDevice.drawable);
+    }
+
+    XFlush(kDevice.display);
+}
+
+void HideWindow(HWND window) noexcept
+{
+    SetWindowVisible(window, false);
+}
+
+///
+/// Dispatches the provided event to the callbacks.
+///
+/// \return Whether the event is not a quit message.
+///
+LEPONG_NODISCARD static bool Dispatch(XEvent& event) noexcept;
+
+bool PollEvents() noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(sDisplay, false);
+
+    auto keepRunning = true;
+
+    // XPending sends the pending requests and reads what the server already sent, it never waits for new events.
+    while (XPending(sDisplay) > 0)
+    {
+        XEvent event;
+        XNextEvent(sDisplay, &event);
+
+        keepRunning = Dispatch(event) && keepRunning;
+    }
+
+    return keepRunning;
+}
+
+///
+/// Calls the key callback for a key event, the presses of a held key are ignored.
+///
+static void OnKey(XKeyEvent& event, bool pressed) noexcept;
+
+///
+/// \return Whether the provided key release is immediately followed by a press of the same key, an auto-repeat.
+///
+LEPONG_NODISCARD static bool IsAutoRepeat(const XKeyEvent& event) noexcept;
+
+///
+/// Calls the resize callback if the window's size changed.
+///
+static void OnConfigure(const XConfigureEvent& event) noexcept;
+
+bool Dispatch(XEvent& event) noexcept
+{
+    switch (event.type)
+    {
+    case ClientMessage:
+        // ^ This assumes there will always be a single window.
+        return static_cast<Atom>(event.xclient.data.l[0]) != sDeleteMessage;
+
+    case KeyPress:
+        OnKey(event.xkey, true);
+        break;
+
+    case KeyRelease:
+    {
+        if (!IsAutoRepeat(event.xkey))
+        {
+            OnKey(event.xkey, false);
+        }
+
+        break;
+    }
+
+    case ConfigureNotify:
+        OnConfigure(event.xconfigure);
+        break;
+
+    case MappingNotify:
+        XRefreshKeyboardMapping(&event.xmapping);
+        break;
+
+    default: break;
+    }
+
+    return true;
+}
+
+///
+/// \return The Windows virtual key code of the provided key symbol, 0 if it doesn't have one.
+///
+LEPONG_NODISCARD static int TranslateKey(KeySym symbol) noexcept;
+
+void OnKey(XKeyEvent& event, bool pressed) noexcept
+{
+    auto& held = sHeldKeys[event.keycode & 0xFFu];
+
+    if (pressed && held)
+    {
+        // Ignore the event if the key is held down.
+        return;
+    }
+
+    held = pressed;
+
+    LEPONG_CHECK_OR_RETURN(sKeyCallback);
+
+    // The unshifted symbol, so a key has the same code whatever the modifiers are.
+    const auto kKey = TranslateKey(XLookupKeysym(&event, 0));
+    LEPONG_CHECK_OR_RETURN(kKey);
+
+    sKeyCallback(kKey, pressed);
+}
+
+bool IsAutoRepeat(const XKeyEvent& event) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(!sDetectableAutoRepeat, false);
+
+    // Without detectable auto-repeat, the server sends a release and a press with the same time for a held key. The
+    // press is sent with the release, reading what already arrived is enough and never waits.
+    LEPONG_CHECK_OR_RETURN_VAL(XEventsQueued(sDisplay, QueuedAfterReading) > 0, false);
+
+    XEvent next;
+    XPeekEvent(sDisplay, &next);
+
+    return
+        next.type == KeyPress &&
+        next.xkey.keycode == event.keycode &&
+        next.xkey.time == event.time;
+}
+
+int TranslateKey(KeySym symbol) noexcept
+{
+    if (symbol >= XK_a && symbol <= XK_z)
+    {
+        return static_cast<int>('A' + (symbol - XK_a));
+    }
+
+    if (symbol >= XK_0 && symbol <= XK_9)
+    {
+        return static_cast<int>('0' + (symbol - XK_0));
+    }
+
+    if (symbol >= XK_F1 && symbol <= XK_F12)
+    {
+        return static_cast<int>(0x70 + (symbol - XK_F1)); // VK_F1.
+    }
+
+    switch (symbol)
+    {
+    case XK_BackSpace: return 0x08; // VK_BACK.
+    case XK_Tab:       return 0x09; // VK_TAB.
+    case XK_Return:    return 0x0D; // VK_RETURN.
+    case XK_Shift_L:
+    case XK_Shift_R:   return 0x10; // VK_SHIFT.
+    case XK_Control_L:
+    case XK_Control_R: return 0x11; // VK_CONTROL.
+    case XK_Escape:    return 0x1B; // VK_ESCAPE.
+    case XK_space:     return 0x20; // VK_SPACE.
+    case XK_Left:      return 0x25; // VK_LEFT.
+    case XK_Up:        return 0x26; // VK_UP.
+    case XK_Right:     return 0x27; // VK_RIGHT.
+    case XK_Down:      return 0x28; // VK_DOWN.
+    default:           return 0;
+    }
+}
+
+void OnConfigure(const XConfigureEvent& event) noexcept
+{
+    XPointer data = nullptr;
+    LEPONG_CHECK_OR_RETURN(XFindContext(sDisplay, event.window, sWindowContext, &data) == 0);
+
+    auto& window = *reinterpret_cast<HWND__*>(data);
+
+    const Vector2i kSize = { event.width, event.height };
+    LEPONG_CHECK_OR_RETURN(kSize.x != window.size.x || kSize.y != window.size.y);
+
+    window.size = kSize;
+
+    if (sResizeCallback)
+    {
+        sResizeCallback(kSize);
+    }
+}
+
+} // namespace lepong::Window
@@ -0,0 +1,46 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#pragma once
+
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+
+#include "lepong/Math/Vector2.h"
+
+// The X11 definitions of the handles declared by "Window.h" and "GL.h", shared by the window and the GLX context.<br>
+// Xlib defines macros such as None, True and False: lepong headers must be included before this one.
+
+///
+/// A window's drawable, what a GLX context renders to.
+///
+struct HDC__
+{
+    Display* display = nullptr;
+    ::Window drawable = 0;
+};
+
+struct HWND__
+{
+    HDC__ device;
+
+    // The last size reported to the resize callback, configure events are also sent when the window moves.
+    lepong::Vector2i size;
+
+    // The window's visual is the OpenGL one, which usually isn't the root window's, so it needs its own colormap.
+    Colormap colormap = 0;
+};
+
+namespace lepong::Graphics::GL
+{
+
+///
+/// Chooses the visual of the framebuffer configuration the OpenGL contexts are created with. Windows must be created
+/// with it, X can't change the visual of an existing window.
+///
+/// \return The visual, to be freed with XFree, nullptr if no visual of the screen supports OpenGL.
+///
+LEPONG_NODISCARD XVisualInfo* ChooseVisual(Display* display, int screen) noexcept;
+
+} // namespace lepong::Graphics::GL
@@ -8,20 +8,41 @@
 #include "lepong/Check.h"
 #include "lepong/lepong.h"
 #include "lepong/Window.h"
+#include "lepong/Game/Analytics.h"
 #include "lepong/Game/Game.h"
+#include "lepong/Game/RunAhead.h"
+#include "lepong/Game/GridViewer.h"
+#include "lepong/Game/SdfRenderer.h"
+#include "lepong/Graphics/Bloom.h"
+#include "lepong/Graphics/DynamicResolution.h"
+#include "lepong/Graphics/FrameUniforms.h"
+#include "lepong/Graphics/GpuTimer.h"
 #include "lepong/Graphics/Quad.h"
+#include "lepong/Graphics/Trace.h"
 #include "lepong/Math/Math.h"
+#include "lepong/Memory/Allocations.h"
+#include "lepong/Memory/FrameArena.h"
+#include "lepong/Metrics/Metrics.h"
+#include "lepong/Replay/FlightRecorder.h"
+#include "lepong/Replay/InputScript.h"
+#include "lepong/Replay/Replay.h"
+#include "lepong/Time/Profiler.h"
 #include "lepong/Time/Time.h"
 
 namespace lepong
 {
 
-// Hardcoded but this should be fine on most monitors (maybe a bit small for 2k+).
-static constexpr Vector2i skWinSize = { 1280, 720 };
+// The window initially shows the whole terrain, one terrain unit per pixel at 96 DPI. The terrain is the world the
+// projection fits in the window at any size.
+static constexpr Vector2i skWinSize = Match::skTerrainSize;
 
 static auto sInitialized = false;
 
 static HWND sWindow;
+
+// The size of the window's client area in pixels, applied to the rendering state at the next frame when it changes.
+static Vector2i sWinSize;
+static auto sWinSizeChanged = false;
 static gl::Context sContext;
 
 static GLuint sPaddleProgram;
@@ -30,20 +51,31 @@ static GLuint sBallProgram;
 static Graphics::Mesh sQuad;
 static Graphics::Mesh sTexturedQuad;
 
-// Game state.
-static bool sPlaying = false;
-static unsigned sPlayerScores[] = { 0u, 0u };
+// Only created when selected, the quads are used otherwise.
+static SdfRenderer::Renderer sSdfRenderer;
+
+// Only created when selected, makes the quads glow.
+static Bloom::Effect sBloom;
 
-// Ball.
-static constexpr float skBallRadius = 20.0f;
+// Only created when selected, shows a grid of simulated matches instead of the local match.
+static GridViewer::Viewer sGridViewer;
 
-static Ball sBall{ skBallRadius, sTexturedQuad, sBallProgram };
+// Only created when selected, renders the scene at a resolution that holds the GPU frame time budget.
+static Graphics::DynamicResolution::Scaler sScaler;
 
-// Paddles.
-static constexpr Vector2f skPaddleSize = { 25.0f, 150.0f };
+// Only created when selected, renders the match a few ticks ahead of its real state.
+static RunAhead::Predictor sPredictor;
+
+// Game state.
+static Match sMatch{ sQuad, sTexturedQuad, sPaddleProgram, sBallProgram };
 
-static Paddle sPaddle1{ skPaddleSize,  1.0f, sQuad, sPaddleProgram };
-static Paddle sPaddle2{ skPaddleSize, -1.0f, sQuad, sPaddleProgram };
+// Desync detection.
+static std::uint64_t sStateHash = 0u;
+
+static Analytics::MatchAnalytics sAnalytics;
+
+// Set when the match is won, the next one is started at the end of the frame.
+static auto sMatchOver = false;
 
 ///
 /// A class holding the init and cleanup functions of any item.
@@ -189,10 +221,17 @@ void CleanupItemsStartingAt(ConstArrayReference<Lifetime, NumItems> lifetimes, u
 static constexpr Lifetime skSystemLifetimes[] =
 {
     { Log::Init, Log::Cleanup },
+    { Allocations::Init, Allocations::Cleanup },
+    { FrameArena::Init, FrameArena::Cleanup },
+    { FlightRecorder::Init, FlightRecorder::Cleanup },
     { Window::Init, Window::Cleanup },
     { Graphics::Init, Graphics::Cleanup },
     { gl::Init, gl::Cleanup },
-    { Time::Init, Time::Cleanup }
+    { Time::Init, Time::Cleanup },
+    { Profiler::Init, Profiler::Cleanup },
+    { Metrics::Init, Metrics::Cleanup },
+    { Replay::Init, Replay::Cleanup },
+    { Analytics::Init, Analytics::Cleanup }
 };
 
 bool InitGameSystems() noexcept
@@ -227,6 +266,11 @@ LEPONG_NODISCARD static bool InitGameWindow() noexcept;
 ///
 static void CleanupGameWindow() noexcept;
 
+///
+/// Loads the input script if one was selected.
+///
+LEPONG_NODISCARD static bool InitInputScript() noexcept;
+
 ///
 /// \return Whether the rendering context was successfully initialized.
 ///
@@ -237,6 +281,21 @@ LEPONG_NODISCARD static bool InitContext() noexcept;
 ///
 static void CleanupContext() noexcept;
 
+///
+/// Starts recording the OpenGL calls if a trace was requested.
+///
+LEPONG_NODISCARD static bool InitTrace() noexcept;
+
+///
+/// Finishes the trace.
+///
+static void CleanupTrace() noexcept;
+
+///
+/// Creates the uniform buffer shared by every program.
+///
+LEPONG_NODISCARD static bool InitFrameUniforms() noexcept;
+
 ///
 /// \return Whether the graphics resources were successfully initialized.
 ///
@@ -247,14 +306,29 @@ LEPONG_NODISCARD static bool InitGraphicsResources() noexcept;
 ///
 static void CleanupGraphicsResources() noexcept;
 
+///
+/// Creates the run-ahead predictor if it was selected.
+///
+LEPONG_NODISCARD static bool InitRunAhead() noexcept;
+
+///
+/// Logs how many frames were predicted.
+///
+static void CleanupRunAhead() noexcept;
+
 ///
 /// All the game state lifetimes.
 ///
 static constexpr Lifetime kStateLifetimes[] =
 {
     { InitGameWindow, CleanupGameWindow },
+    { InitInputScript, InputScript::Cleanup },
     { InitContext, CleanupContext },
+    { InitTrace, CleanupTrace },
+    { InitFrameUniforms, Graphics::FrameUniforms::Cleanup },
+    { Graphics::GpuTimer::Init, Graphics::GpuTimer::Cleanup },
     { InitGraphicsResources, CleanupGraphicsResources },
+    { InitRunAhead, CleanupRunAhead },
 };
 
 bool InitState() noexcept
@@ -268,114 +342,52 @@ bool InitState() noexcept
 ///
 static void OnKeyEvent(int key, bool pressed) noexcept;
 
+///
+/// \param size The new size of the window's client area.
+///
+static void OnResizeEvent(const Vector2i& size) noexcept;
+
 bool InitGameWindow() noexcept
 {
     Window::SetKeyCallback(OnKeyEvent);
+    Window::SetResizeCallback(OnResizeEvent);
+
     sWindow = Window::MakeWindow(skWinSize, L"lepong");
+    sWinSize = Window::GetClientSize(sWindow);
+
     return sWindow;
 }
 
-///
-/// What does this do?
-///
-static void OnKeyUp(int key) noexcept;
-
-///
-/// Huh.
-///
-static void OnKeyDown(int key) noexcept;
-
-///
-/// Sets the ball's direction to a random diagonal direction.
-///
-static void LaunchBall() noexcept;
-
 void OnKeyEvent(int key, bool pressed) noexcept
 {
-    if (sPlaying)
-    {
-        if (pressed)
-        {
-            OnKeyDown(key);
-        }
-        else
-        {
-            OnKeyUp(key);
-        }
-    }
-    else if (pressed && key == VK_SPACE)
-    {
-        sPlaying = true;
-        LaunchBall();
-    }
-}
-
-// Ugly input code below.
+    Replay::RecordKeyEvent(key, pressed);
+    FlightRecorder::RecordKeyEvent(key, pressed);
 
-static constexpr int skP2Up = VK_UP;
-static constexpr int skP2Down = VK_DOWN;
-static constexpr int skP1Up = 'W';
-static constexpr int skP1Down = 'S';
+    sMatch.OnKeyEvent(key, pressed);
+}
 
-void OnKeyUp(int key) noexcept
+void OnResizeEvent(const Vector2i& size) noexcept
 {
-    switch (key)
-    {
-    case skP2Up:
-        sPaddle2.OnMoveUpReleased();
-        break;
-
-    case skP2Down:
-        sPaddle2.OnMoveDownReleased();
-        break;
-
-    case skP1Up:
-        sPaddle1.OnMoveUpReleased();
-        break;
-
-    case skP1Down:
-        sPaddle1.OnMoveDownReleased();
-        break;
-
-    default: break;
-    }
+    // Messages can be sent before the context exists, the rendering state is only updated when a frame begins.
+    sWinSize = size;
+    sWinSizeChanged = true;
 }
 
-void OnKeyDown(int key) noexcept
+void CleanupGameWindow() noexcept
 {
-    switch (key)
-    {
-    case skP2Up:
-        sPaddle2.OnMoveUpPressed();
-        break;
-
-    case skP2Down:
-        sPaddle2.OnMoveDownPressed();
-        break;
-
-    case skP1Up:
-        sPaddle1.OnMoveUpPressed();
-        break;
-
-    case skP1Down:
-        sPaddle1.OnMoveDownPressed();
-        break;
-
-    default: break;
-    }
+    Window::DestroyWindow(sWindow);
 }
 
-void LaunchBall() noexcept
+bool InitInputScript() noexcept
 {
-    sBall.moveSpeed = Ball::skDefaultMoveSpeed;
+    LEPONG_CHECK_OR_RETURN_VAL(InputScript::IsSelected(), true);
+    LEPONG_CHECK_OR_RETURN_VAL(InputScript::Load(), false);
 
-    sBall.moveDirection = { RandomSignFloat(), RandomSignFloat() };
-    sBall.moveDirection = Normalize(sBall.moveDirection);
-}
+    Log::Log(InputScript::GetMode() == InputScript::Mode::Fast
+        ? "Running the input script as fast as possible"
+        : "Running the input script in real time");
 
-void CleanupGameWindow() noexcept
-{
-    Window::DestroyWindow(sWindow);
+    return true;
 }
 
 bool InitContext() noexcept
@@ -396,6 +408,24 @@ void CleanupContext() noexcept
     gl::DestroyContext(sContext);
 }
 
+bool InitTrace() noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(Graphics::Trace::IsSelected(), true);
+
+    Log::Log("Recording an OpenGL trace");
+    return Graphics::Trace::StartRecording(sWinSize);
+}
+
+void CleanupTrace() noexcept
+{
+    Graphics::Trace::StopRecording();
+}
+
+bool InitFrameUniforms() noexcept
+{
+    return Graphics::FrameUniforms::Init(skWinSize, sWinSize);
+}
+
 ///
 /// \return Can you guess?
 ///
@@ -436,6 +466,46 @@ LEPONG_NODISCARD static bool InitTexturedQuad() noexcept;
 ///
 static void CleanupTexturedQuad() noexcept;
 
+///
+/// Creates the SDF renderer if it was selected.
+///
+LEPONG_NODISCARD static bool InitSdfRenderer() noexcept;
+
+///
+/// Destroys the SDF renderer.
+///
+static void CleanupSdfRenderer() noexcept;
+
+///
+/// Creates the bloom effect if it was selected.
+///
+LEPONG_NODISCARD static bool InitBloom() noexcept;
+
+///
+/// Destroys the bloom effect.
+///
+static void CleanupBloom() noexcept;
+
+///
+/// Creates the grid viewer if it was selected.
+///
+LEPONG_NODISCARD static bool InitGridViewer() noexcept;
+
+///
+/// Stops the grid viewer.
+///
+static void CleanupGridViewer() noexcept;
+
+///
+/// Creates the offscreen target of the dynamic resolution if it was selected.
+///
+LEPONG_NODISCARD static bool InitDynamicResolution() noexcept;
+
+///
+/// Destroys the offscreen target.
+///
+static void CleanupDynamicResolution() noexcept;
+
 ///
 /// All the graphics resource lifetimes.
 ///
@@ -445,6 +515,10 @@ static constexpr Lifetime skGraphicsResourceLifetimes[] =
     { InitBallProgram, CleanupBallProgram },
     { InitQuad, CleanupQuad },
     { InitTexturedQuad, CleanupTexturedQuad },
+    { InitSdfRenderer, CleanupSdfRenderer },
+    { InitBloom, CleanupBloom },
+    { InitGridViewer, CleanupGridViewer },
+    { InitDynamicResolution, CleanupDynamicResolution },
 };
 
 bool InitGraphicsResources() noexcept
@@ -453,54 +527,29 @@ bool InitGraphicsResources() noexcept
 }
 
 ///
-/// Creates a program using the provided shaders and loads the <b>uWinSize</b> uniform.<br>
-/// The provided shaders are then destroyed.
+/// Creates a program using the provided shaders, then destroys them.
 ///
-LEPONG_NODISCARD static GLuint CreateProgramWithWinSizeUniform(GLuint vertex, GLuint fragment) noexcept;
+LEPONG_NODISCARD static GLuint CreateProgram(GLuint vertex, GLuint fragment) noexcept;
 
 bool InitPaddleProgram() noexcept
 {
-    sPaddleProgram = CreateProgramWithWinSizeUniform(
+    sPaddleProgram = CreateProgram(
         Graphics::MakeQuadVertexShader(), MakePaddleFragmentShader()
     );
 
     return sPaddleProgram;
 }
 
-///
-/// Loads the window size value into the corresponding uniform in the provided program.
-///
-static void LoadWinSizeUniform(GLuint program) noexcept;
-
-GLuint CreateProgramWithWinSizeUniform(GLuint vertex, GLuint fragment) noexcept
+GLuint CreateProgram(GLuint vertex, GLuint fragment) noexcept
 {
     const auto kProgram = Graphics::CreateProgramFromShaders(vertex, fragment);
 
     gl::DeleteShader(vertex);
     gl::DeleteShader(fragment);
 
-    if (kProgram)
-    {
-        LoadWinSizeUniform(kProgram);
-    }
-
     return kProgram;
 }
 
-void LoadWinSizeUniform(GLuint program) noexcept
-{
-    constexpr Vector2f kWinSize =
-    {
-        static_cast<float>(skWinSize.x),
-        static_cast<float>(skWinSize.y)
-    };
-
-    gl::UseProgram(program);
-
-    const auto kLocation = gl::GetUniformLocation(program, "uWinSize");
-    gl::Uniform2f(kLocation, kWinSize.x, kWinSize.y);
-}
-
 void CleanupPaddleProgram() noexcept
 {
     gl::DeleteProgram(sPaddleProgram);
@@ -508,8 +557,11 @@ void CleanupPaddleProgram() noexcept
 
 bool InitBallProgram() noexcept
 {
-    sBallProgram = CreateProgramWithWinSizeUniform(
-        Graphics::MakeTexturedQuadVertexShader(), MakeBallFragmentShader()
+    // The bloom effect replaces the ball's own glow.
+    const auto kFragment = Bloom::IsSelected() ? MakeBallCoreFragmentShader() : MakeBallFragmentShader();
+
+    sBallProgram = CreateProgram(
+        Graphics::MakeTexturedQuadVertexShader(), kFragment
     );
 
     return sBallProgram;
@@ -542,11 +594,103 @@ void CleanupTexturedQuad() noexcept
     Graphics::DestroyMesh(sTexturedQuad);
 }
 
+bool InitSdfRenderer() noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(SdfRenderer::IsSelected(), true);
+
+    Log::Log("Rendering with the SDF renderer");
+
+    sSdfRenderer = SdfRenderer::MakeRenderer();
+    return sSdfRenderer.IsValid();
+}
+
+void CleanupSdfRenderer() noexcept
+{
+    SdfRenderer::DestroyRenderer(sSdfRenderer);
+}
+
+bool InitBloom() noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(Bloom::IsSelected(), true);
+
+    Log::Log("Rendering with bloom");
+
+    sBloom = Bloom::MakeEffect(sWinSize);
+    return sBloom.IsValid();
+}
+
+void CleanupBloom() noexcept
+{
+    Bloom::DestroyEffect(sBloom);
+}
+
+bool InitGridViewer() noexcept
+{
+    const auto kGridSize = GridViewer::GetSelectedGridSize();
+    LEPONG_CHECK_OR_RETURN_VAL(kGridSize, true);
+
+    Log::Log("Showing the grid viewer");
+
+    return GridViewer::MakeViewer(sGridViewer, kGridSize, skWinSize);
+}
+
+void CleanupGridViewer() noexcept
+{
+    GridViewer::DestroyViewer(sGridViewer);
+}
+
+bool InitDynamicResolution() noexcept
+{
+    const auto kBudget = Graphics::DynamicResolution::GetSelectedBudget();
+    LEPONG_CHECK_OR_RETURN_VAL(kBudget, true);
+
+    // The analytic renderer shades window pixels, it can't render to a smaller target.
+    if (sSdfRenderer.IsValid())
+    {
+        Log::Log("Dynamic resolution is not supported by the SDF renderer");
+        return true;
+    }
+
+    Log::Log("Rendering with dynamic resolution");
+
+    sScaler = Graphics::DynamicResolution::MakeScaler(sWinSize, kBudget);
+    return sScaler.IsValid();
+}
+
+void CleanupDynamicResolution() noexcept
+{
+    Graphics::DynamicResolution::DestroyScaler(sScaler);
+}
+
 void CleanupGraphicsResources() noexcept
 {
     CleanupItems(skGraphicsResourceLifetimes);
 }
 
+bool InitRunAhead() noexcept
+{
+    const auto kTicks = RunAhead::GetSelectedTicks();
+    LEPONG_CHECK_OR_RETURN_VAL(kTicks, true);
+
+    // The grid viewer doesn't render the local match.
+    if (sGridViewer.IsValid())
+    {
+        Log::Log("Run-ahead is not supported by the grid viewer");
+        return true;
+    }
+
+    Log::Log("Rendering with run-ahead");
+
+    sPredictor = RunAhead::MakePredictor(kTicks);
+    return true;
+}
+
+void CleanupRunAhead() noexcept
+{
+    RunAhead::LogSummary(sPredictor);
+    sPredictor = {};
+}
+
 void CleanupState() noexcept
 {
     CleanupItems(kStateLifetimes);
@@ -574,11 +718,46 @@ static void OnUpdate(float delta) noexcept;
 ///
 static void OnRender() noexcept;
 
+///
+/// Updates the viewport and everything sized after the window to the window's current size.
+///
+static void ApplyWinSize() noexcept;
+
+///
+/// Draws the ball and paddles with quads, as emitters of the bloom effect.
+///
+static void RenderMatchObjects() noexcept;
+
+///
+/// Writes the bloom effect's glow around the ball and paddles.
+///
+static void ApplyBloom() noexcept;
+
 ///
 /// Called when exiting the main loop.
 ///
 static void OnFinishRun() noexcept;
 
+///
+/// Seeds the random number generator and starts a new match, recording it.
+///
+static void StartMatch(std::uint32_t seed) noexcept;
+
+///
+/// Adds the match being recorded to the replay archive and writes its analytics.
+///
+static void ArchiveMatch() noexcept;
+
+///
+/// Counts the won match, which is only archived at the end of the frame since that writes to files.
+///
+static void OnMatchEnd(void* user, const Match& match, Side winner) noexcept;
+
+///
+/// Archives the won match and starts the next one.
+///
+static void StartNextMatch() noexcept;
+
 void Run() noexcept
 {
     LEPONG_CHECK_OR_RETURN(sInitialized && !sRunning);
@@ -586,16 +765,43 @@ void Run() noexcept
     sRunning = true;
     OnBeginRun();
 
+    Allocations::SetPhase(Allocations::Phase::Frame);
+
     while (sRunning)
     {
+        FrameArena::BeginFrame();
         sRunning = Window::PollEvents();
 
         const auto cDelta = GetTimeDelta();
+
+        // Scripted key events go through the same path as the window's.
+        sRunning = InputScript::Feed(cDelta, OnKeyEvent) && sRunning;
+
+        // The steady state must not allocate.
+        Allocations::BeginHotSection();
         OnUpdate(cDelta);
 
+        // The frame shows the match a few ticks ahead, the real match is back before the next events.
+        RunAhead::BeginPrediction(sPredictor, sMatch, cDelta);
         OnRender();
+        RunAhead::EndPrediction(sPredictor, sMatch);
+        Allocations::EndHotSection();
+
+        const auto kFrameTime = Profiler::OnFrameEnd();
+        RunAhead::Adjust(sPredictor, kFrameTime);
+        Metrics::RecordFrame(kFrameTime);
+        FlightRecorder::RecordFrameTime(kFrameTime);
+        Replay::WritePending();
+        Analytics::WritePending(sAnalytics);
+        Allocations::OnFrameEnd();
+
+        if (sMatchOver)
+        {
+            StartNextMatch();
+        }
     }
 
+    Allocations::SetPhase(Allocations::Phase::Cleanup);
     OnFinishRun();
 }
 
@@ -604,27 +810,29 @@ void Run() noexcept
 ///
 static void LogContextSpecifications() noexcept;
 
-///
-/// Resets the game state.
-///
-static void ResetGameState() noexcept;
-
-///
-/// Properly sets the paddle positions on the terrain.
-///
-static void PositionPaddlesOnTerrain() noexcept;
-
 void OnBeginRun() noexcept
 {
     Window::ShowWindow(sWindow);
-    Window::SetWindowResizable(sWindow, false);
 
     LogContextSpecifications();
-    ResetGameState();
-    PositionPaddlesOnTerrain();
 
-    const auto kCurrentTime = (unsigned)time(nullptr);
-    srand(kCurrentTime);
+    // Scripted runs can set the seed to be reproducible.
+    StartMatch(InputScript::GetSeed((unsigned)time(nullptr)));
+}
+
+void StartMatch(std::uint32_t seed) noexcept
+{
+    SeedRandom(seed);
+    Replay::BeginMatch(seed);
+    FlightRecorder::BeginMatch(seed);
+
+    Analytics::BeginMatch(sAnalytics, seed);
+    sMatch.listener = Analytics::MakeListener(sAnalytics);
+
+    // The listener's user data is the analytics', the game's callback only uses globals.
+    sMatch.listener.onMatchEnd = OnMatchEnd;
+
+    sMatch.Start();
 }
 
 #define LEPONG_LOG_GL_STRING(name) \
@@ -637,97 +845,192 @@ void LogContextSpecifications() noexcept
     LEPONG_LOG_GL_STRING(gl::Renderer);
 }
 
-void ResetGameState() noexcept
+float GetTimeDelta() noexcept
 {
-    sBall.Reset(skWinSize);
+    // The frames take whatever time they take, the match is the same on every run.
+    LEPONG_CHECK_OR_RETURN_VAL(InputScript::GetMode() != InputScript::Mode::Fast, InputScript::skFastDelta);
 
-    sPaddle1.Reset(skWinSize);
-    sPaddle2.Reset(skWinSize);
+    static auto sLastTime = 0.0f;
+
+    const auto kNow = Time::Get();
+    const auto kTimeDelta = kNow - sLastTime;
+    sLastTime = kNow;
 
-    sPlaying = false;
+    return kTimeDelta;
 }
 
-void PositionPaddlesOnTerrain() noexcept
+void OnUpdate(float delta) noexcept
 {
-    const auto kBorderOffset = 50.0f;
+    const auto kStart = Time::GetNanoseconds();
+
+    sMatch.Update(delta);
+
+    const auto kState = sMatch.CaptureState();
+    sStateHash = HashState(kState);
 
-    sPaddle1.position.x = kBorderOffset;
-    sPaddle2.position.x = skWinSize.x - kBorderOffset;
+    Replay::RecordTick(delta, sStateHash);
+    FlightRecorder::RecordTick(delta, sStateHash, kState);
+
+    const auto kUpdateTime = Time::GetNanoseconds() - kStart;
+    Profiler::Record(Profiler::Timer::Update, kUpdateTime);
+    RunAhead::RecordTick(sPredictor, kUpdateTime);
+
+    Metrics::RecordTick(kUpdateTime);
+    Metrics::SetScores(sMatch.playerScores[0], sMatch.playerScores[1]);
 }
 
-float GetTimeDelta() noexcept
+void OnRender() noexcept
 {
-    static auto sLastTime = 0.0f;
+    using Graphics::GpuTimer::Pass;
 
-    const auto kNow = Time::Get();
-    const auto kTimeDelta = kNow - sLastTime;
-    sLastTime = kNow;
+    const auto kStart = Time::GetNanoseconds();
+    Graphics::GpuTimer::BeginFrame();
 
-    return kTimeDelta;
-}
+    if (sWinSizeChanged)
+    {
+        ApplyWinSize();
+        sWinSizeChanged = false;
+    }
 
-///
-/// Handles ball collision with terrain sides.
-///
-static void CheckBallSideCollision() noexcept;
+    Graphics::FrameUniforms::Update(Time::Get());
 
-void OnUpdate(float delta) noexcept
-{
-    sBall.Update(delta);
+    if (sScaler.IsValid())
+    {
+        Graphics::DynamicResolution::Update(sScaler, Graphics::GpuTimer::GetFrameTime());
+        Graphics::DynamicResolution::BeginScene(sScaler);
 
-    sPaddle1.Update(delta, skWinSize);
-    sPaddle2.Update(delta, skWinSize);
+        if (sBloom.IsValid())
+        {
+            Bloom::SetTarget(sBloom, sScaler.GetTargetFramebuffer(), sScaler.renderSize);
+        }
+    }
 
-    sBall.CollideWithTerrain(skWinSize);
+    if (sGridViewer.IsValid())
+    {
+        GridViewer::Render(sGridViewer);
+        Graphics::GpuTimer::EndPass(Pass::Scene);
+    }
+    else if (sSdfRenderer.IsValid())
+    {
+        SdfRenderer::Render(sSdfRenderer, sMatch);
+        Graphics::GpuTimer::EndPass(Pass::Scene);
+    }
+    else
+    {
+        gl::Clear(gl::ColorBufferBit);
+        Graphics::GpuTimer::EndPass(Pass::Clear);
 
-    const auto kCollides =
-        sBall.CollideWith(sPaddle1) ||
-        sBall.CollideWith(sPaddle2);
+        // The glow is written first, the objects are drawn over it.
+        if (sBloom.IsValid())
+        {
+            Bloom::BeginEmitters(sBloom);
+            RenderMatchObjects();
+            Bloom::EndEmitters(sBloom);
+
+            ApplyBloom();
+            Graphics::GpuTimer::EndPass(Pass::Post);
+        }
 
-    if (!kCollides)
+        sMatch.ball.Render();
+        Graphics::GpuTimer::EndPass(Pass::Ball);
+
+        sMatch.paddle1.Render();
+        sMatch.paddle2.Render();
+        Graphics::GpuTimer::EndPass(Pass::Paddles);
+    }
+
+    if (sScaler.IsValid() && sScaler.IsScaled())
     {
-        CheckBallSideCollision();
+        Graphics::DynamicResolution::EndScene(sScaler);
+        Graphics::GpuTimer::EndPass(Pass::Upscale);
     }
-}
 
-///
-/// Gives the point to the player corresponding to the provided side.<br>
-/// The player who won the point is the player opposite to the provided side.
-///
-static void UpdateScores(Side lostSide) noexcept;
+    const auto kSwapStart = Time::GetNanoseconds();
+    Profiler::Record(Profiler::Timer::Render, kSwapStart - kStart);
 
-void CheckBallSideCollision() noexcept
+    gl::SwapBuffers(sContext);
+    Graphics::GpuTimer::EndPass(Pass::Swap);
+
+    Profiler::Record(Profiler::Timer::Swap, Time::GetNanoseconds() - kSwapStart);
+
+    Graphics::Trace::RecordFrameEnd();
+}
+
+void ApplyWinSize() noexcept
 {
-    const auto kSide = sBall.GetTouchingSide(skWinSize);
+    gl::Viewport(0, 0, sWinSize.x, sWinSize.y);
+    Graphics::FrameUniforms::Resize(sWinSize);
+
+    if (sScaler.IsValid())
+    {
+        Graphics::DynamicResolution::Resize(sScaler, sWinSize);
+    }
 
-    if (kSide != Side::None)
+    if (sBloom.IsValid())
     {
-        UpdateScores(kSide);
-        ResetGameState();
+        Bloom::SetTarget(sBloom, 0, sWinSize);
     }
 }
 
-void UpdateScores(Side lostSide) noexcept
+void RenderMatchObjects() noexcept
 {
-    const auto kScoreIndex = 1u - static_cast<unsigned>(lostSide);
-    ++sPlayerScores[kScoreIndex];
+    sMatch.ball.Render();
+
+    sMatch.paddle1.Render();
+    sMatch.paddle2.Render();
 }
 
-void OnRender() noexcept
+void ApplyBloom() noexcept
 {
-    gl::Clear(gl::ColorBufferBit);
+    const auto& kBall = sMatch.ball;
+    const auto& kPaddle1 = sMatch.paddle1;
+    const auto& kPaddle2 = sMatch.paddle2;
 
-    sBall.Render();
+    const auto kBallDiameter = kBall.radius * 2.0f;
 
-    sPaddle1.Render();
-    sPaddle2.Render();
+    const GLfloat kRegions[] =
+    {
+        kBall.position.x, kBall.position.y, kBallDiameter, kBallDiameter,
+        kPaddle1.position.x, kPaddle1.position.y, kPaddle1.size.x, kPaddle1.size.y,
+        kPaddle2.position.x, kPaddle2.position.y, kPaddle2.size.x, kPaddle2.size.y
+    };
 
-    gl::SwapBuffers(sContext);
+    Bloom::Apply(sBloom, kRegions, 3u);
 }
 
 void OnFinishRun() noexcept
 {
     Window::HideWindow(sWindow);
+
+    // The match being played is unfinished, it is archived but not counted.
+    ArchiveMatch();
+}
+
+void ArchiveMatch() noexcept
+{
+    Replay::MatchSummary summary;
+    summary.playerScores[0] = sMatch.playerScores[0];
+    summary.playerScores[1] = sMatch.playerScores[1];
+    summary.numRallies = sMatch.numRallies;
+    summary.numPaddleHits = sMatch.numPaddleHits;
+
+    Replay::FinishMatch(summary);
+    Analytics::Flush(sAnalytics);
+}
+
+void OnMatchEnd(void*, const Match&, Side) noexcept
+{
+    Metrics::RecordMatch();
+    sMatchOver = true;
+}
+
+void StartNextMatch() noexcept
+{
+    sMatchOver = false;
+    ArchiveMatch();
+
+    // The next seed comes from the generator, so scripted runs stay reproducible.
+    StartMatch(GetRandomState());
 }
 
 void Cleanup() noexcept
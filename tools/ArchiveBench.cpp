@@ -0,0 +1,295 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "lepong/Check.h"
+#include "lepong/Log.h"
+#include "lepong/Replay/Archive.h"
+#include "lepong/Time/Histogram.h"
+
+using namespace lepong;
+
+// Measures how fast the replay archive of the current directory is read: replays loaded at random the way
+// lepong_query --rallies loads its candidates, and the whole index scanned the way column predicates scan it.
+// With --fill, synthetic matches are appended to the archive first so that it can be measured without playing them.
+// The archive was usually just written or read, the numbers are for a warm page cache.
+
+struct Options
+{
+    std::uint32_t numFilledMatches = 0u;
+    std::uint32_t maxTicks = 14400u; // Two minutes at 120 ticks per second.
+
+    std::uint32_t numLoads = 1000u;
+    double scanSeconds = 2.0;
+};
+
+static constexpr float skTickDelta = 1.0f / 120.0f;
+
+///
+/// Prints the command line usage.
+///
+static void PrintUsage() noexcept
+{
+    std::puts(
+        "Usage: lepong_archivebench [--fill <n>] [--ticks <t>] [--loads <l>] [--seconds <s>]\n"
+        "\n"
+        "Loads <l> random replays (1000) from the archive and prints the load latency, then scans every index\n"
+        "column for <s> seconds (2) and prints the scan throughput.\n"
+        "With --fill, <n> synthetic matches of up to <t> ticks (14400) are appended to the archive first.");
+}
+
+///
+/// Fills the options from the command line.
+///
+/// \return Whether the command line was valid.
+///
+LEPONG_NODISCARD static bool ParseOptions(int argc, char** argv, Options& options) noexcept;
+
+///
+/// \return The next value of a xorshift generator, the synthetic matches don't need the game's.
+///
+LEPONG_NODISCARD static std::uint64_t NextRandom(std::uint64_t& state) noexcept
+{
+    state ^= state << 13u;
+    state ^= state >> 7u;
+    state ^= state << 17u;
+
+    return state;
+}
+
+///
+/// Appends synthetic matches to the archive through the same writer as the game.
+///
+/// \return Whether the archive could be opened for appending.
+///
+LEPONG_NODISCARD static bool FillArchive(const Options& options) noexcept;
+
+///
+/// Loads random replays and reads all of their records, then prints the latency of each load.
+///
+static void MeasureLoads(Replay::ArchiveReader& reader, const Options& options) noexcept;
+
+///
+/// Scans every index column repeatedly, then prints the throughput.
+///
+static void MeasureScans(const Replay::ArchiveReader& reader, const Options& options) noexcept;
+
+int main(int argc, char** argv)
+{
+    Options options;
+
+    if (!ParseOptions(argc, argv, options) || !Log::Init())
+    {
+        PrintUsage();
+        return -1;
+    }
+
+    if (options.numFilledMatches && !FillArchive(options))
+    {
+        std::fputs("Failed to open the replay archive for appending\n", stderr);
+        Log::Cleanup();
+        return -1;
+    }
+
+    auto reader = Replay::OpenArchive();
+    const auto kValid = reader.IsValid() && Replay::GetNumMatches(reader);
+
+    if (kValid)
+    {
+        MeasureLoads(reader, options);
+        MeasureScans(reader, options);
+    }
+    else
+    {
+        std::fputs("No replay archive with matches found in the current directory\n", stderr);
+    }
+
+    Replay::CloseArchive(reader);
+    Log::Cleanup();
+
+    return kValid ? 0 : -1;
+}
+
+bool ParseOptions(int argc, char** argv, Options& options) noexcept
+{
+    for (auto i = 1; i + 1 < argc; i += 2)
+    {
+        const auto kValue = argv[i + 1];
+        const auto kNumber = static_cast<std::uint32_t>(std::strtoul(kValue, nullptr, 10));
+
+        if (std::strcmp(argv[i], "--fill") == 0)
+        {
+            options.numFilledMatches = kNumber;
+        }
+        else if (std::strcmp(argv[i], "--ticks") == 0)
+        {
+            options.maxTicks = kNumber;
+        }
+        else if (std::strcmp(argv[i], "--loads") == 0)
+        {
+            options.numLoads = kNumber;
+        }
+        else if (std::strcmp(argv[i], "--seconds") == 0)
+        {
+            options.scanSeconds = std::strtod(kValue, nullptr);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    // Every option has a value.
+    return argc % 2 == 1 && options.maxTicks && options.numLoads && options.scanSeconds > 0.0;
+}
+
+bool FillArchive(const Options& options) noexcept
+{
+    LEPONG_CHECK_OR_RETURN_VAL(Replay::Init(), false);
+
+    std::uint64_t random = 0x9E3779B97F4A7C15ull;
+
+    for (std::uint32_t i = 0; i < options.numFilledMatches; ++i)
+    {
+        Replay::BeginMatch(static_cast<std::uint32_t>(NextRandom(random)));
+
+        const auto kNumTicks = 1u + static_cast<std::uint32_t>(NextRandom(random) % options.maxTicks);
+
+        for (std::uint32_t tick = 0; tick < kNumTicks; ++tick)
+        {
+            // Random hashes don't compress, like real ones.
+            Replay::RecordTick(skTickDelta, NextRandom(random));
+        }
+
+        // The loser's score doesn't matter to the measurements, only that it varies.
+        Replay::MatchSummary summary;
+        summary.playerScores[i % 2u] = 11u;
+        summary.playerScores[1u - i % 2u] = static_cast<std::uint32_t>(NextRandom(random) % 11u);
+        summary.numRallies = summary.playerScores[0] + summary.playerScores[1];
+        summary.numPaddleHits = kNumTicks / 120u;
+
+        Replay::FinishMatch(summary);
+    }
+
+    Replay::Cleanup();
+    return true;
+}
+
+void MeasureLoads(Replay::ArchiveReader& reader, const Options& options) noexcept
+{
+    using Clock = std::chrono::steady_clock;
+
+    static Time::Histogram sLoadTimes;
+
+    const auto kNumMatches = Replay::GetNumMatches(reader);
+
+    std::uint64_t random = 0xD1B54A32D192ED03ull;
+    std::uint64_t numBytes = 0u;
+    std::uint64_t checksum = 0u;
+
+    for (std::uint32_t i = 0; i < options.numLoads; ++i)
+    {
+        const auto kMatch = static_cast<std::uint32_t>(NextRandom(random) % kNumMatches);
+        const auto kStart = Clock::now();
+
+        // The view is zero-copy, a load only costs something once its records are read.
+        const auto kReplay = Replay::LoadReplay(reader, kMatch);
+
+        for (std::size_t record = 0; record < kReplay.numRecords; ++record)
+        {
+            checksum += kReplay.records[record].stateHash;
+        }
+
+        const auto kElapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - kStart).count();
+        Time::RecordValue(sLoadTimes, static_cast<std::uint64_t>(kElapsed));
+
+        numBytes += sizeof(Replay::BlobHeader) + kReplay.numRecords * sizeof(Replay::Record);
+    }
+
+    const auto kTotalSeconds = static_cast<double>(sLoadTimes.sum) / 1e9;
+
+    std::printf(
+        "%u random loads of %.1f KiB on average: mean %.1f us, p50 %.1f us, p99 %.1f us, max %.1f us, %.2f GB/s\n"
+        "checksum %016llx\n",
+        options.numLoads, static_cast<double>(numBytes) / options.numLoads / 1024.0,
+        Time::GetMean(sLoadTimes) / 1e3,
+        static_cast<double>(Time::GetValueAtPercentile(sLoadTimes, 50.0)) / 1e3,
+        static_cast<double>(Time::GetValueAtPercentile(sLoadTimes, 99.0)) / 1e3,
+        static_cast<double>(Time::GetValueAtPercentile(sLoadTimes, 100.0)) / 1e3,
+        static_cast<double>(numBytes) / kTotalSeconds / 1e9,
+        static_cast<unsigned long long>(checksum));
+}
+
+///
+/// \return The sum of the provided column slice, which keeps the compiler from skipping the scan.
+///
+template<typename T>
+LEPONG_NODISCARD static std::uint64_t SumColumn(
+    const Replay::ArchiveReader& reader, std::uint32_t block, Replay::Column column, std::uint32_t count) noexcept
+{
+    const auto kValues = Replay::GetColumn<T>(reader, block, column);
+    std::uint64_t sum = 0u;
+
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        sum += kValues[i];
+    }
+
+    return sum;
+}
+
+void MeasureScans(const Replay::ArchiveReader& reader, const Options& options) noexcept
+{
+    using Clock = std::chrono::steady_clock;
+
+    const auto kNumMatches = Replay::GetNumMatches(reader);
+    const auto kNumBlocks = (kNumMatches + Replay::skIndexBlockSize - 1u) / Replay::skIndexBlockSize;
+
+    std::size_t rowBytes = 0u;
+
+    for (const auto kWidth : Replay::skColumnWidths)
+    {
+        rowBytes += kWidth;
+    }
+
+    const auto kStart = Clock::now();
+    const auto kDuration = std::chrono::duration<double>(options.scanSeconds);
+
+    std::uint64_t numScans = 0u;
+    std::uint64_t checksum = 0u;
+
+    while (Clock::now() - kStart < kDuration)
+    {
+        for (std::uint32_t block = 0; block < kNumBlocks; ++block)
+        {
+            const auto kCount = Replay::GetNumBlockRows(reader, block);
+
+            for (unsigned column = 0; column < static_cast<unsigned>(Replay::Column::Count); ++column)
+            {
+                const auto kColumn = static_cast<Replay::Column>(column);
+
+                // Durations are summed as raw bits, only the bytes read matter here.
+                checksum += Replay::skColumnWidths[column] == sizeof(std::uint64_t)
+                    ? SumColumn<std::uint64_t>(reader, block, kColumn, kCount)
+                    : SumColumn<std::uint32_t>(reader, block, kColumn, kCount);
+            }
+        }
+
+        ++numScans;
+    }
+
+    const auto kElapsed = std::chrono::duration<double>(Clock::now() - kStart).count();
+    const auto kIndexBytes = static_cast<double>(kNumMatches) * static_cast<double>(rowBytes);
+
+    std::printf(
+        "%llu scans of %u matches (%.1f MiB of columns): %.2f ms per scan, %.2f GB/s\n"
+        "checksum %016llx\n",
+        static_cast<unsigned long long>(numScans), kNumMatches, kIndexBytes / 1048576.0,
+        kElapsed * 1e3 / static_cast<double>(numScans), kIndexBytes * static_cast<double>(numScans) / kElapsed / 1e9,
+        static_cast<unsigned long long>(checksum));
+}
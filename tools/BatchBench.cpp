@@ -0,0 +1,417 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <thread>
+
+#include "lepong/Check.h"
+#include "lepong/Batch/Batch.h"
+#include "lepong/Batch/Sharding.h"
+#include "lepong/Log.h"
+#include "lepong/Memory/Allocations.h"
+#include "lepong/Memory/FrameArena.h"
+
+using namespace lepong;
+
+// Measures how fast a batch is stepped the way a training loop steps it: the tracking policy stands in for the agent,
+// it decides once per step, the matches are simulated for the action repeat, then rewarded and observed.
+// With --workers, the matches are sharded across the NUMA nodes instead of stepped by the main thread alone.
+// The workers' frame arenas are then reported in lepong.log, for sizing.
+// The steady state runs in a strict hot section, the first allocation in it after the warm-up aborts.
+// With --check, nothing is measured: a fixed batch is stepped with the SSE2 code and with the scalar code, and both
+// runs must hash to the reference, which was recorded with the per-match scoring that preceded the masked one.
+
+struct Options
+{
+    unsigned numMatches = 4096u;
+    unsigned actionRepeat = 1u;
+    double seconds = 5.0;
+
+    bool sharded = false;
+    unsigned workersPerNode = 0u;
+
+    Batch::Pages pages = Batch::Pages::Normal;
+};
+
+// The check's batch leaves a scalar tail after the groups of 4, and half of its players idle now and then so that
+// points are scored on both sides.
+static constexpr unsigned skCheckMatches = 1027u;
+static constexpr std::uint32_t skCheckSeed = 7u;
+static constexpr unsigned skCheckDecisions = 20000u;
+static constexpr unsigned skCheckRepeat = 3u;
+
+static constexpr std::uint64_t skCheckReferenceHash = 0xCB66D0CF1FC35E11ull;
+
+static constexpr const char* skPageNames[] =
+{
+    "normal",
+    "transparent",
+    "huge"
+};
+
+///
+/// Prints the command line usage.
+///
+static void PrintUsage() noexcept
+{
+    std::puts(
+        "Usage: lepong_batchbench [--matches <n>] [--repeat <ticks>] [--seconds <s>] [--workers <w>] [--pages <p>]\n"
+        "       lepong_batchbench --check\n"
+        "\n"
+        "Steps a batch of <n> matches (4096) for <s> seconds (5), one decision every <ticks> ticks (1), and prints\n"
+        "the decisions and ticks per second.\n"
+        "With --workers, the matches are sharded across <w> pinned threads per NUMA node, 0 for one per processor,\n"
+        "and the throughput of each node is printed.\n"
+        "With --pages, the large arrays are backed by normal (default), transparent or huge pages when possible.\n"
+        "With --check, the SSE2 and scalar steps are compared with each other and with the reference results.");
+}
+
+///
+/// Fills the options from the command line.
+///
+/// \return Whether the command line was valid.
+///
+LEPONG_NODISCARD static bool ParseOptions(int argc, char** argv, Options& options) noexcept;
+
+///
+/// Steps the check's batch with the SSE2 code, then with the scalar code, and prints the hashes.
+///
+/// \return Whether both runs hashed to the reference.
+///
+LEPONG_NODISCARD static bool Check() noexcept;
+
+///
+/// Steps the batch for the provided options and prints the rates.
+///
+/// \return Whether every buffer was allocated.
+///
+LEPONG_NODISCARD static bool Run(const Options& options) noexcept;
+
+///
+/// Steps a sharded batch for the provided options and prints the rates of each node.
+///
+/// \return Whether every shard was allocated.
+///
+LEPONG_NODISCARD static bool RunSharded(const Options& options) noexcept;
+
+///
+/// Prints how much of the arrays currently allocated is backed by each kind of pages.
+///
+static void PrintPages() noexcept;
+
+int main(int argc, char** argv)
+{
+    if (argc == 2 && std::strcmp(argv[1], "--check") == 0)
+    {
+        return Check() ? 0 : -1;
+    }
+
+    Options options;
+
+    if (!ParseOptions(argc, argv, options))
+    {
+        PrintUsage();
+        return -1;
+    }
+
+    Batch::SetArrayPages(options.pages);
+
+    const auto kSucceeded = options.sharded ? RunSharded(options) : Run(options);
+    return kSucceeded ? 0 : -1;
+}
+
+bool ParseOptions(int argc, char** argv, Options& options) noexcept
+{
+    for (auto i = 1; i + 1 < argc; i += 2)
+    {
+        const auto kValue = argv[i + 1];
+
+        if (std::strcmp(argv[i], "--matches") == 0)
+        {
+            options.numMatches = static_cast<unsigned>(std::strtoul(kValue, nullptr, 10));
+        }
+        else if (std::strcmp(argv[i], "--repeat") == 0)
+        {
+            options.actionRepeat = static_cast<unsigned>(std::strtoul(kValue, nullptr, 10));
+        }
+        else if (std::strcmp(argv[i], "--seconds") == 0)
+        {
+            options.seconds = std::strtod(kValue, nullptr);
+        }
+        else if (std::strcmp(argv[i], "--workers") == 0)
+        {
+            options.sharded = true;
+            options.workersPerNode = static_cast<unsigned>(std::strtoul(kValue, nullptr, 10));
+        }
+        else if (std::strcmp(argv[i], "--pages") == 0)
+        {
+            auto pages = 0u;
+
+            while (pages < std::size(skPageNames) && std::strcmp(kValue, skPageNames[pages]) != 0)
+            {
+                ++pages;
+            }
+
+            if (pages == std::size(skPageNames))
+            {
+                return false;
+            }
+
+            options.pages = static_cast<Batch::Pages>(pages);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    // Every option has a value.
+    return argc % 2 == 1 && options.numMatches && options.actionRepeat && options.seconds > 0.0;
+}
+
+///
+/// Mixes the provided bytes into an FNV-1a hash.
+///
+static void Hash(std::uint64_t& hash, const void* data, std::size_t size) noexcept
+{
+    const auto kBytes = static_cast<const unsigned char*>(data);
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ kBytes[i]) * 0x100000001B3ull;
+    }
+}
+
+///
+/// Steps the check's batch with the current code and hashes every reward and observation, then the final scores
+/// and random states.
+///
+/// \return The hash, 0 if the batch couldn't be allocated.
+///
+LEPONG_NODISCARD static std::uint64_t HashCheckRun() noexcept
+{
+    auto batch = Batch::MakeBatch(skCheckMatches, skCheckSeed);
+
+    const auto kActionsSize = skCheckMatches * sizeof(Batch::Action);
+    const auto kPlayer1Actions = static_cast<Batch::Action*>(Batch::AllocateArrays(kActionsSize));
+    const auto kPlayer2Actions = static_cast<Batch::Action*>(Batch::AllocateArrays(kActionsSize));
+    const auto kRewards = static_cast<float*>(Batch::AllocateArrays(skCheckMatches * sizeof(float)));
+
+    const auto kObservationsSize = skCheckMatches * Batch::skObservationSize * sizeof(float);
+    const auto kObservations = static_cast<float*>(Batch::AllocateArrays(kObservationsSize));
+
+    std::uint64_t hash = 0u;
+
+    if (batch.IsValid() && kPlayer1Actions && kPlayer2Actions && kRewards && kObservations)
+    {
+        hash = 0xCBF29CE484222325ull;
+
+        for (auto decision = 0u; decision < skCheckDecisions; ++decision)
+        {
+            Batch::ComputeTrackingActions(batch, kPlayer1Actions, kPlayer2Actions);
+
+            // A fifth of the first players idle, a different fifth every 50 decisions.
+            for (auto i = 0u; i < skCheckMatches; ++i)
+            {
+                if ((i * 7u + decision / 50u) % 5u == 0u)
+                {
+                    kPlayer1Actions[i] = Batch::Action::None;
+                }
+            }
+
+            Batch::StepRepeated(batch, kPlayer1Actions, kPlayer2Actions, skCheckRepeat, kRewards, kObservations);
+
+            Hash(hash, kRewards, skCheckMatches * sizeof(float));
+            Hash(hash, kObservations, kObservationsSize);
+        }
+
+        Hash(hash, batch.player1Scores, skCheckMatches * sizeof(std::uint32_t));
+        Hash(hash, batch.player2Scores, skCheckMatches * sizeof(std::uint32_t));
+        Hash(hash, batch.randomStates, skCheckMatches * sizeof(std::uint32_t));
+        Hash(hash, &batch.numFinishedMatches, sizeof(batch.numFinishedMatches));
+    }
+
+    Batch::FreeArrays(kObservations);
+    Batch::FreeArrays(kRewards);
+    Batch::FreeArrays(kPlayer2Actions);
+    Batch::FreeArrays(kPlayer1Actions);
+    Batch::DestroyBatch(batch);
+
+    return hash;
+}
+
+bool Check() noexcept
+{
+    const auto kVectorizedHash = HashCheckRun();
+
+    Batch::SetVectorized(false);
+    const auto kScalarHash = HashCheckRun();
+    Batch::SetVectorized(true);
+
+    const auto kPassed = kVectorizedHash == skCheckReferenceHash && kScalarHash == skCheckReferenceHash;
+
+    std::printf(
+        "%u matches, %u decisions of %u ticks\n"
+        "SSE2:      %016llx\n"
+        "scalar:    %016llx\n"
+        "reference: %016llx\n"
+        "%s\n",
+        skCheckMatches, skCheckDecisions, skCheckRepeat,
+        static_cast<unsigned long long>(kVectorizedHash),
+        static_cast<unsigned long long>(kScalarHash),
+        static_cast<unsigned long long>(skCheckReferenceHash),
+        kPassed ? "OK" : "MISMATCH");
+
+    return kPassed;
+}
+
+bool Run(const Options& options) noexcept
+{
+    auto batch = Batch::MakeBatch(options.numMatches, 1u);
+
+    const auto kNumMatches = options.numMatches;
+
+    const auto kPlayer1Actions = static_cast<Batch::Action*>(Batch::AllocateArrays(kNumMatches * sizeof(Batch::Action)));
+    const auto kPlayer2Actions = static_cast<Batch::Action*>(Batch::AllocateArrays(kNumMatches * sizeof(Batch::Action)));
+    const auto kRewards = static_cast<float*>(Batch::AllocateArrays(kNumMatches * sizeof(float)));
+
+    const auto kObservations = static_cast<float*>(
+        Batch::AllocateArrays(static_cast<std::size_t>(kNumMatches) * Batch::skObservationSize * sizeof(float)));
+
+    const auto kAllocated = batch.IsValid() && kPlayer1Actions && kPlayer2Actions && kRewards && kObservations;
+
+    if (kAllocated)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        const auto kStart = Clock::now();
+        const auto kDuration = std::chrono::duration<double>(options.seconds);
+
+        std::uint64_t numDecisions = 0u;
+        double totalReward = 0.0;
+
+        Allocations::SetPhase(Allocations::Phase::Frame);
+        Allocations::SetStrict(true);
+
+        // The clock is only read every few decisions, a small batch steps faster than it. Those decisions count as
+        // a frame toward the allocation tracker's warm-up.
+        while (Clock::now() - kStart < kDuration)
+        {
+            Allocations::BeginHotSection();
+
+            for (auto i = 0u; i < 16u; ++i)
+            {
+                Batch::ComputeTrackingActions(batch, kPlayer1Actions, kPlayer2Actions);
+
+                Batch::StepRepeated(
+                    batch, kPlayer1Actions, kPlayer2Actions, options.actionRepeat, kRewards, kObservations);
+
+                totalReward += kRewards[numDecisions % kNumMatches];
+                ++numDecisions;
+            }
+
+            Allocations::EndHotSection();
+            Allocations::OnFrameEnd();
+        }
+
+        Allocations::SetStrict(false);
+        Allocations::SetPhase(Allocations::Phase::Cleanup);
+
+        const auto kElapsed = std::chrono::duration<double>(Clock::now() - kStart).count();
+        const auto kNumTicks = static_cast<double>(batch.numSteps);
+
+        const auto& kSteadyCounters = Allocations::GetPhaseCounters(Allocations::Phase::Frame);
+
+        std::printf(
+            "%u matches, %u ticks per decision: %.0f decisions/s, %.0f ticks/s, %.3g match ticks/s\n"
+            "%llu finished matches, sampled reward %+.0f\n"
+            "%llu allocations in the steady state\n",
+            kNumMatches, options.actionRepeat,
+            static_cast<double>(numDecisions) / kElapsed, kNumTicks / kElapsed, kNumTicks * kNumMatches / kElapsed,
+            static_cast<unsigned long long>(batch.numFinishedMatches), totalReward,
+            static_cast<unsigned long long>(kSteadyCounters.numAllocations.load(std::memory_order_relaxed)));
+
+        PrintPages();
+    }
+    else
+    {
+        std::fprintf(stderr, "Failed to allocate a batch of %u matches\n", kNumMatches);
+    }
+
+    Batch::FreeArrays(kObservations);
+    Batch::FreeArrays(kRewards);
+    Batch::FreeArrays(kPlayer2Actions);
+    Batch::FreeArrays(kPlayer1Actions);
+    Batch::DestroyBatch(batch);
+
+    return kAllocated;
+}
+
+bool RunSharded(const Options& options) noexcept
+{
+    Batch::ShardedBatch batch;
+
+    if (!Batch::StartShardedBatch(batch, options.numMatches, 1u, options.workersPerNode, options.actionRepeat))
+    {
+        std::fprintf(stderr, "Failed to start the workers\n");
+        return false;
+    }
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(options.seconds));
+
+    // The workers free their shards when they stop.
+    PrintPages();
+    Batch::StopShardedBatch(batch);
+
+    // The workers' arenas are in the report once they are destroyed.
+    if (Log::Init())
+    {
+        FrameArena::LogReport();
+        Log::Cleanup();
+    }
+
+    const auto& kTopology = batch.topology;
+    auto allocated = true;
+
+    double totalMatchTicks = 0.0;
+    double totalMatchDecisions = 0.0;
+
+    std::printf(
+        "%u matches in %u shards on %u node%s, %u ticks per decision\n",
+        options.numMatches, batch.numShards, kTopology.numNodes, kTopology.IsNuma() ? "s" : "", options.actionRepeat);
+
+    for (auto i = 0u; i < kTopology.numNodes; ++i)
+    {
+        const auto kThroughput = Batch::GetNodeThroughput(batch, i);
+
+        std::printf(
+            "node %u: %u workers%s, %u matches, %.3g match decisions/s, %.3g match ticks/s, %llu finished matches%s\n",
+            kTopology.nodes[i].id, kThroughput.numWorkers, kThroughput.pinned ? "" : " (not pinned)",
+            kThroughput.numMatches, kThroughput.matchDecisionsPerSecond, kThroughput.matchTicksPerSecond,
+            static_cast<unsigned long long>(kThroughput.numFinishedMatches),
+            kThroughput.allocated ? "" : " (allocation failed)");
+
+        allocated &= kThroughput.allocated;
+        totalMatchTicks += kThroughput.matchTicksPerSecond;
+        totalMatchDecisions += kThroughput.matchDecisionsPerSecond;
+    }
+
+    std::printf("total: %.3g match decisions/s, %.3g match ticks/s\n", totalMatchDecisions, totalMatchTicks);
+
+    Batch::DestroyShardedBatch(batch);
+    return allocated;
+}
+
+void PrintPages() noexcept
+{
+    std::printf(
+        "pages: %.1f MiB normal, %.1f MiB transparent, %.1f MiB huge\n",
+        Batch::GetArrayBytes(Batch::Pages::Normal) / 1048576.0,
+        Batch::GetArrayBytes(Batch::Pages::Transparent) / 1048576.0,
+        Batch::GetArrayBytes(Batch::Pages::Huge) / 1048576.0);
+}
@@ -0,0 +1,216 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include "lepong/Check.h"
+#include "lepong/Game/Match.h"
+#include "lepong/Replay/FlightRecorder.h"
+#include "lepong/Time/Histogram.h"
+
+using namespace lepong;
+
+///
+/// A flight recorder dump loaded in memory.
+///
+struct Dump
+{
+    FlightRecorder::DumpHeader header;
+
+    std::vector<FlightRecorder::Snapshot> snapshots;
+    std::vector<Replay::Record> records;
+    std::vector<std::uint64_t> frameTimes;
+};
+
+///
+/// Reads a dump file.
+///
+/// \return Whether the file is a valid dump.
+///
+LEPONG_NODISCARD static bool LoadDump(const char* path, Dump& dump) noexcept;
+
+///
+/// Prints the frame time distribution and the last frames.
+///
+static void PrintFrameTimes(const Dump& dump) noexcept;
+
+///
+/// Prints the last recorded events.
+///
+static void PrintLastRecords(const Dump& dump) noexcept;
+
+///
+/// Re-simulates the recorded ticks from the oldest usable snapshot and checks them against the recorded hashes.
+///
+static void ReplayDump(const Dump& dump) noexcept;
+
+int main(int argc, char** argv)
+{
+    const auto kPath = argc > 1 ? argv[1] : FlightRecorder::skDumpPath;
+
+    Dump dump;
+
+    if (!LoadDump(kPath, dump))
+    {
+        std::fprintf(stderr, "Usage: lepong_crash [dump file]\n\n%s is not a valid flight recorder dump\n", kPath);
+        return -1;
+    }
+
+    std::printf(
+        "Crash reason 0x%08X, match seed %u\n%u snapshots, %u records, %u frame times\n\n",
+        dump.header.reason, dump.header.seed,
+        dump.header.numSnapshots, dump.header.numRecords, dump.header.numFrameTimes);
+
+    PrintFrameTimes(dump);
+    PrintLastRecords(dump);
+    ReplayDump(dump);
+}
+
+///
+/// Reads <i>count</i> elements at the end of the provided vector.
+///
+/// \return Whether every element was read.
+///
+template<typename T>
+LEPONG_NODISCARD static bool ReadElements(std::FILE* file, std::vector<T>& elements, std::uint32_t count) noexcept
+{
+    elements.resize(count);
+    return std::fread(elements.data(), sizeof(T), count, file) == count;
+}
+
+bool LoadDump(const char* path, Dump& dump) noexcept
+{
+    std::FILE* file = nullptr;
+    fopen_s(&file, path, "rb");
+
+    LEPONG_CHECK_OR_RETURN_VAL(file, false);
+
+    const auto kValid =
+        std::fread(&dump.header, sizeof(dump.header), 1, file) == 1 &&
+        dump.header.magic == FlightRecorder::skDumpMagic &&
+        dump.header.version == FlightRecorder::skDumpVersion &&
+        ReadElements(file, dump.snapshots, dump.header.numSnapshots) &&
+        ReadElements(file, dump.records, dump.header.numRecords) &&
+        ReadElements(file, dump.frameTimes, dump.header.numFrameTimes);
+
+    std::fclose(file);
+    return kValid;
+}
+
+// Enough frames to see what led to the crash without flooding the console.
+static constexpr std::size_t skNumLastFrames = 16u;
+static constexpr std::size_t skNumLastRecords = 16u;
+
+///
+/// The frame time histogram, too big for the stack.
+///
+static Time::Histogram sFrameTimes;
+
+void PrintFrameTimes(const Dump& dump) noexcept
+{
+    LEPONG_CHECK_OR_RETURN(!dump.frameTimes.empty());
+
+    for (const auto kFrameTime : dump.frameTimes)
+    {
+        Time::RecordValue(sFrameTimes, kFrameTime);
+    }
+
+    std::printf(
+        "Frame times: mean %.2fms, p50 %.2fms, p99 %.2fms, max %.2fms\nLast frames:",
+        Time::GetMean(sFrameTimes) / 1e6,
+        static_cast<double>(Time::GetValueAtPercentile(sFrameTimes, 50.0)) / 1e6,
+        static_cast<double>(Time::GetValueAtPercentile(sFrameTimes, 99.0)) / 1e6,
+        static_cast<double>(Time::GetValueAtPercentile(sFrameTimes, 100.0)) / 1e6);
+
+    const auto kFirst = dump.frameTimes.size() - std::min(dump.frameTimes.size(), skNumLastFrames);
+
+    for (auto i = kFirst; i < dump.frameTimes.size(); ++i)
+    {
+        std::printf(" %.2fms", static_cast<double>(dump.frameTimes[i]) / 1e6);
+    }
+
+    std::puts("\n");
+}
+
+void PrintLastRecords(const Dump& dump) noexcept
+{
+    const auto kFirst = dump.records.size() - std::min(dump.records.size(), skNumLastRecords);
+
+    std::puts("Last records:");
+
+    for (auto i = kFirst; i < dump.records.size(); ++i)
+    {
+        const auto& kRecord = dump.records[i];
+        const auto kIndex = static_cast<unsigned long long>(dump.header.firstRecord + i);
+
+        if (kRecord.type == Replay::RecordType::KeyEvent)
+        {
+            std::printf("  #%llu key 0x%02X %s\n", kIndex, kRecord.key, kRecord.pressed ? "pressed" : "released");
+        }
+        else
+        {
+            std::printf(
+                "  #%llu tick %.3fms, state %016llX\n", kIndex,
+                kRecord.delta * 1e3f, static_cast<unsigned long long>(kRecord.stateHash));
+        }
+    }
+
+    std::puts("");
+}
+
+void ReplayDump(const Dump& dump) noexcept
+{
+    // The oldest snapshot whose following records were all kept.
+    const FlightRecorder::Snapshot* snapshot = nullptr;
+
+    for (const auto& kSnapshot : dump.snapshots)
+    {
+        if (kSnapshot.record >= dump.header.firstRecord)
+        {
+            snapshot = &kSnapshot;
+            break;
+        }
+    }
+
+    if (!snapshot)
+    {
+        std::puts("No snapshot covers the recorded ticks, the match can't be replayed");
+        return;
+    }
+
+    auto simulation = MakeHeadlessMatch();
+    simulation.RestoreState(snapshot->state);
+    simulation.tick = snapshot->tick;
+
+    const auto kFirst = static_cast<std::size_t>(snapshot->record - dump.header.firstRecord);
+
+    for (auto i = kFirst; i < dump.records.size(); ++i)
+    {
+        const auto& kRecord = dump.records[i];
+
+        if (kRecord.type == Replay::RecordType::KeyEvent)
+        {
+            simulation.OnKeyEvent(kRecord.key, kRecord.pressed);
+            continue;
+        }
+
+        simulation.Update(kRecord.delta);
+
+        if (HashState(simulation.CaptureState()) != kRecord.stateHash)
+        {
+            std::printf(
+                "Replay diverged at tick %llu, the simulation is not deterministic\n",
+                static_cast<unsigned long long>(simulation.tick));
+
+            return;
+        }
+    }
+
+    std::printf(
+        "Replayed ticks %llu to %llu without divergence, final score %u - %u\n",
+        static_cast<unsigned long long>(snapshot->tick), static_cast<unsigned long long>(simulation.tick),
+        simulation.playerScores[0], simulation.playerScores[1]);
+}
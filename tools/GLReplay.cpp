@@ -0,0 +1,876 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "lepong/Check.h"
+#include "lepong/FileMapping.h"
+#include "lepong/Window.h"
+#include "lepong/Graphics/GL.h"
+#include "lepong/Graphics/Graphics.h"
+#include "lepong/Graphics/Trace.h"
+#include "lepong/Time/Histogram.h"
+#include "lepong/Time/Time.h"
+
+using namespace lepong;
+namespace Trace = Graphics::Trace;
+
+using Trace::Call;
+
+// Prints or replays a trace recorded with LEPONG_GL_TRACE, see "lepong/Graphics/Trace.h".<br>
+// With --dump, the frames are replayed once and the last one is written to a binary PPM file. Two traces recorded
+// from the same input script in fast mode render the same matches, their dumps can be compared byte for byte to check
+// that a rendering change, or another renderer, draws the same pixels. In PowerShell, with a script ending in quit:
+//     $env:LEPONG_INPUT_SCRIPT = "check.txt"; $env:LEPONG_INPUT_SCRIPT_MODE = "fast"
+//     $env:LEPONG_GL_TRACE = "quads.trace"; .\lepong
+//     $env:LEPONG_GL_TRACE = "sdf.trace"; $env:LEPONG_RENDERER = "sdf"; .\lepong
+//     .\lepong_glreplay quads.trace --dump quads.ppm; .\lepong_glreplay sdf.trace --dump sdf.ppm
+//     fc.exe /b quads.ppm sdf.ppm
+
+static constexpr const char* skCallNames[] =
+{
+    "FrameEnd",
+    "CreateShader",
+    "DeleteShader",
+    "ShaderSource",
+    "CompileShader",
+    "CreateProgram",
+    "DeleteProgram",
+    "AttachShader",
+    "LinkProgram",
+    "UseProgram",
+    "GenVertexArrays",
+    "DeleteVertexArrays",
+    "BindVertexArray",
+    "GenBuffers",
+    "DeleteBuffers",
+    "BindBuffer",
+    "BufferData",
+    "BufferSubData",
+    "EnableVertexAttribArray",
+    "VertexAttribPointer",
+    "VertexAttribDivisor",
+    "DrawElements",
+    "DrawElementsInstanced",
+    "DrawArrays",
+    "GenTextures",
+    "DeleteTextures",
+    "BindTexture",
+    "ActiveTexture",
+    "TexImage2D",
+    "TexParameteri",
+    "GenFramebuffers",
+    "DeleteFramebuffers",
+    "BindFramebuffer",
+    "FramebufferTexture2D",
+    "Viewport",
+    "Clear",
+    "GetUniformLocation",
+    "Uniform2f",
+    "Uniform1i",
+    "Uniform1f",
+    "Uniform4fv",
+    "GetUniformBlockIndex",
+    "UniformBlockBinding",
+    "BindBufferBase",
+};
+
+static_assert(std::size(skCallNames) == static_cast<std::size_t>(Call::Count));
+
+///
+/// Reads a trace in place.<br>
+/// Reading past the end returns zeros and invalidates the reader instead of failing on every read.
+///
+struct Reader
+{
+    const unsigned char* cursor = nullptr;
+    const unsigned char* end = nullptr;
+
+    bool valid = true;
+};
+
+template<typename T>
+LEPONG_NODISCARD static T Read(Reader& reader) noexcept
+{
+    T value{};
+
+    if (static_cast<std::size_t>(reader.end - reader.cursor) < sizeof(T))
+    {
+        reader.valid = false;
+        return value;
+    }
+
+    // The arguments are packed, they may not be aligned.
+    std::memcpy(&value, reader.cursor, sizeof(T));
+    reader.cursor += sizeof(T);
+
+    return value;
+}
+
+LEPONG_NODISCARD static Trace::Blob ReadBlob(Reader& reader) noexcept
+{
+    const auto kSize = Read<std::uint32_t>(reader);
+
+    if (static_cast<std::size_t>(reader.end - reader.cursor) < kSize)
+    {
+        reader.valid = false;
+        return {};
+    }
+
+    const Trace::Blob kBlob{ kSize ? reader.cursor : nullptr, kSize };
+    reader.cursor += kSize;
+
+    return kBlob;
+}
+
+///
+/// Reads a command's arguments as described by its signature, printing them if <i>print</i> is true.
+///
+static void ReadArguments(Reader& reader, Call call, bool print) noexcept;
+
+///
+/// Prints every command in the trace, one per line. Blobs are summarized by their size and a hash, so two traces can
+/// be compared with a text diff.
+///
+static void PrintTrace(Reader reader) noexcept;
+
+///
+/// Replays the trace in a window of the recorded size and prints the frame times.<br>
+/// The first frame also creates the resources and the commands after the last frame destroy them, those are only
+/// replayed once while the frames in between are replayed <i>numLoops</i> times.
+///
+/// \param dumpPath Where the last frame of the last loop is written, nullptr to not write it.
+///
+LEPONG_NODISCARD static bool ReplayTrace(
+    Reader reader, const Trace::TraceHeader& header, unsigned numLoops, const char* dumpPath) noexcept;
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::fputs("Usage: lepong_glreplay <trace file> [--print | --loops <count> | --dump <ppm file>]\n", stderr);
+        return -1;
+    }
+
+    auto mapping = FileMapping::MakeReadOnlyMapping(argv[1]);
+
+    if (!mapping.IsValid())
+    {
+        std::fprintf(stderr, "Failed to open %s\n", argv[1]);
+        return -1;
+    }
+
+    Reader reader;
+    reader.cursor = static_cast<const unsigned char*>(mapping.data);
+    reader.end = reader.cursor + mapping.size;
+
+    const auto kHeader = Read<Trace::TraceHeader>(reader);
+    auto result = 0;
+
+    if (!reader.valid || kHeader.magic != Trace::skMagic || kHeader.version != Trace::skVersion)
+    {
+        std::fprintf(stderr, "%s is not a valid trace\n", argv[1]);
+        result = -1;
+    }
+    else if (argc > 2 && std::strcmp(argv[2], "--print") == 0)
+    {
+        PrintTrace(reader);
+    }
+    else if (argc > 3 && std::strcmp(argv[2], "--dump") == 0)
+    {
+        result = ReplayTrace(reader, kHeader, 1u, argv[3]) ? 0 : -1;
+    }
+    else
+    {
+        const auto kNumLoops = argc > 3 && std::strcmp(argv[2], "--loops") == 0 ? std::atoi(argv[3]) : 1;
+        result = ReplayTrace(reader, kHeader, static_cast<unsigned>(std::max(kNumLoops, 1)), nullptr) ? 0 : -1;
+    }
+
+    FileMapping::DestroyMapping(mapping);
+    return result;
+}
+
+///
+/// 32 bit FNV-1a, enough to tell blobs apart in a diff.
+///
+LEPONG_NODISCARD static std::uint32_t HashBlob(const Trace::Blob& blob) noexcept
+{
+    auto hash = 0x811C9DC5u;
+
+    for (auto i = 0u; i < blob.size; ++i)
+    {
+        hash = (hash ^ static_cast<const unsigned char*>(blob.data)[i]) * 0x01000193u;
+    }
+
+    return hash;
+}
+
+///
+/// Prints the provided arguments if <i>print</i> is true.
+///
+template<typename... Args>
+static void PrintIf(bool print, const char* format, Args... args) noexcept
+{
+    if (print)
+    {
+        std::printf(format, args...);
+    }
+}
+
+void ReadArguments(Reader& reader, Call call, bool print) noexcept
+{
+    for (auto argument = Trace::skCallSignatures[static_cast<std::size_t>(call)]; *argument; ++argument)
+    {
+        switch (*argument)
+        {
+        case 'e':
+            PrintIf(print, " 0x%04X", Read<std::uint32_t>(reader));
+            break;
+        case 'u':
+            PrintIf(print, " %u", Read<std::uint32_t>(reader));
+            break;
+        case 'i':
+            PrintIf(print, " %d", Read<std::int32_t>(reader));
+            break;
+        case 'f':
+            PrintIf(print, " %g", Read<float>(reader));
+            break;
+        case 'b':
+            PrintIf(print, " %u", Read<std::uint8_t>(reader));
+            break;
+        case 'q':
+            PrintIf(print, " %llu", static_cast<unsigned long long>(Read<std::uint64_t>(reader)));
+            break;
+        case 's':
+        {
+            const auto kBlob = ReadBlob(reader);
+            PrintIf(print, " \"%.*s\"", static_cast<int>(kBlob.size), static_cast<const char*>(kBlob.data));
+            break;
+        }
+        case 'x':
+        {
+            const auto kBlob = ReadBlob(reader);
+            PrintIf(print, " <%u bytes %08X>", kBlob.size, HashBlob(kBlob));
+            break;
+        }
+        case 'N':
+        {
+            const auto kCount = Read<std::uint32_t>(reader);
+            PrintIf(print, " [");
+
+            for (auto i = 0u; i < kCount && reader.valid; ++i)
+            {
+                PrintIf(print, i ? " %u" : "%u", Read<std::uint32_t>(reader));
+            }
+
+            PrintIf(print, "]");
+            break;
+        }
+        case 'X':
+        {
+            const auto kCount = Read<std::uint32_t>(reader);
+
+            for (auto i = 0u; i < kCount && reader.valid; ++i)
+            {
+                const auto kBlob = ReadBlob(reader);
+                PrintIf(print, " <%u bytes %08X>", kBlob.size, HashBlob(kBlob));
+            }
+
+            break;
+        }
+        default:
+            reader.valid = false;
+            break;
+        }
+    }
+}
+
+///
+/// Reads the call of the next command.
+///
+/// \return Whether there is a valid command to read.
+///
+LEPONG_NODISCARD static bool ReadCall(Reader& reader, Call& call) noexcept
+{
+    call = static_cast<Call>(Read<std::uint8_t>(reader));
+    return reader.valid && call < Call::Count;
+}
+
+void PrintTrace(Reader reader) noexcept
+{
+    auto frame = 0u;
+    Call call;
+
+    while (reader.cursor < reader.end && ReadCall(reader, call))
+    {
+        std::fputs(skCallNames[static_cast<std::size_t>(call)], stdout);
+        ReadArguments(reader, call, true);
+        std::fputs("\n", stdout);
+
+        if (call == Call::FrameEnd)
+        {
+            std::printf("# Frame %u\n", ++frame);
+        }
+    }
+
+    if (reader.cursor < reader.end)
+    {
+        std::puts("# The trace is truncated or corrupted");
+    }
+}
+
+///
+/// The names of the objects created by the replay, by the names they were recorded with.
+///
+struct NameMap
+{
+    std::unordered_map<GLuint, GLuint> names;
+
+public:
+    LEPONG_NODISCARD GLuint operator[](GLuint recorded) const noexcept
+    {
+        const auto kName = names.find(recorded);
+        return kName == names.end() ? recorded : kName->second;
+    }
+};
+
+// Shaders and programs share their names.
+static NameMap sObjects;
+static NameMap sVertexArrays;
+static NameMap sBuffers;
+static NameMap sTextures;
+static NameMap sFramebuffers;
+
+// The recorded program in use, uniform locations are only meaningful with it.
+static GLuint sProgram = 0;
+
+// The uniform locations in the replay, by recorded program and recorded location.
+static std::unordered_map<std::uint64_t, GLint> sLocations;
+
+// The uniform block indices in the replay, by recorded program and recorded index.
+static std::unordered_map<std::uint64_t, GLuint> sBlockIndices;
+
+///
+/// Runs the next command.
+///
+/// \return Whether the command was valid.
+///
+LEPONG_NODISCARD static bool RunCommand(Reader& reader, Call call) noexcept;
+
+///
+/// Runs the commands until the end of the next frame or the end of the trace.
+///
+/// \return Whether every command was valid.
+///
+LEPONG_NODISCARD static bool RunFrame(Reader& reader) noexcept
+{
+    Call call;
+
+    while (reader.cursor < reader.end)
+    {
+        if (!ReadCall(reader, call) || !RunCommand(reader, call))
+        {
+            return false;
+        }
+
+        if (call == Call::FrameEnd)
+        {
+            break;
+        }
+    }
+
+    return true;
+}
+
+///
+/// The frame time histogram, too big for the stack.
+///
+static Time::Histogram sFrameTimes;
+
+///
+/// Reads the window's back buffer and writes it to a binary PPM file, top row first.
+///
+/// \return Whether the file was written.
+///
+LEPONG_NODISCARD static bool DumpFrame(const char* path, const Vector2i& size) noexcept;
+
+bool ReplayTrace(Reader reader, const Trace::TraceHeader& header, unsigned numLoops, const char* dumpPath) noexcept
+{
+    // Find the frames between the setup and the teardown.
+    std::vector<const unsigned char*> frameEnds;
+    auto scan = reader;
+    Call call;
+
+    while (scan.cursor < scan.end && ReadCall(scan, call))
+    {
+        ReadArguments(scan, call, false);
+
+        if (scan.valid && call == Call::FrameEnd)
+        {
+            frameEnds.push_back(scan.cursor);
+        }
+    }
+
+    LEPONG_CHECK_OR_RETURN_VAL(scan.valid && !frameEnds.empty(), false);
+
+    const auto kInitialized = Window::Init() && Graphics::Init() && Graphics::GL::Init() && Time::Init();
+    LEPONG_CHECK_OR_RETURN_VAL(kInitialized, false);
+
+    const auto kWindow = Window::MakeWindow({ header.winSizeX, header.winSizeY }, L"lepong_glreplay");
+    const auto kContext = Graphics::GL::MakeContext(kWindow);
+
+    LEPONG_CHECK_OR_RETURN_VAL(kContext.IsValid(), false);
+
+    Graphics::GL::MakeContextCurrent(kContext);
+    Window::ShowWindow(kWindow);
+
+    auto valid = RunFrame(reader);
+    Graphics::GL::SwapBuffers(kContext);
+
+    const auto kFirstFrame = reader;
+    auto running = true;
+
+    for (auto loop = 0u; valid && running && loop < numLoops; ++loop)
+    {
+        reader = kFirstFrame;
+
+        while (valid && running && reader.cursor < frameEnds.back())
+        {
+            const auto kStart = Time::GetNanoseconds();
+
+            valid = RunFrame(reader);
+            Graphics::GL::Finish();
+
+            Time::RecordValue(sFrameTimes, Time::GetNanoseconds() - kStart);
+
+            // The back buffer is undefined once swapped.
+            if (valid && dumpPath && loop + 1u == numLoops && reader.cursor == frameEnds.back())
+            {
+                valid = DumpFrame(dumpPath, { header.winSizeX, header.winSizeY });
+            }
+
+            Graphics::GL::SwapBuffers(kContext);
+            running = Window::PollEvents();
+        }
+    }
+
+    valid = valid && RunFrame(reader);
+
+    Graphics::GL::DestroyContext(kContext);
+    Window::DestroyWindow(kWindow);
+
+    Time::Cleanup();
+    Graphics::GL::Cleanup();
+    Graphics::Cleanup();
+    Window::Cleanup();
+
+    LEPONG_CHECK_OR_RETURN_VAL(valid, false);
+
+    std::printf(
+        "%zu frames in the trace, %llu replayed: mean %.3fms, p50 %.3fms, p99 %.3fms, max %.3fms\n",
+        frameEnds.size(), static_cast<unsigned long long>(sFrameTimes.totalCount.load()),
+        Time::GetMean(sFrameTimes) / 1e6,
+        static_cast<double>(Time::GetValueAtPercentile(sFrameTimes, 50.0)) / 1e6,
+        static_cast<double>(Time::GetValueAtPercentile(sFrameTimes, 99.0)) / 1e6,
+        static_cast<double>(Time::GetValueAtPercentile(sFrameTimes, 100.0)) / 1e6);
+
+    return true;
+}
+
+bool DumpFrame(const char* path, const Vector2i& size) noexcept
+{
+    namespace gl = Graphics::GL;
+
+    std::vector<unsigned char> pixels(static_cast<std::size_t>(size.x) * size.y * 4u);
+
+    // The frame may have ended with an offscreen target bound.
+    gl::BindFramebuffer(gl::Framebuffer, 0);
+    gl::ReadPixels(0, 0, size.x, size.y, gl::RGBA, gl::UnsignedByte, pixels.data());
+
+    const auto kFile = std::fopen(path, "wb");
+
+    if (!kFile)
+    {
+        std::fprintf(stderr, "Failed to open %s\n", path);
+        return false;
+    }
+
+    std::fprintf(kFile, "P6\n%d %d\n255\n", size.x, size.y);
+
+    // OpenGL reads the rows bottom first.
+    for (auto y = size.y - 1; y >= 0; --y)
+    {
+        const auto kRow = pixels.data() + static_cast<std::size_t>(y) * size.x * 4u;
+
+        for (auto x = 0; x < size.x; ++x)
+        {
+            std::fwrite(kRow + x * 4, 3, 1, kFile);
+        }
+    }
+
+    std::fclose(kFile);
+    return true;
+}
+
+///
+/// Creates objects with the provided function and maps the recorded names to them.
+///
+static void GenerateNames(Reader& reader, NameMap& map, void (*generate)(GLsizei, GLuint*) noexcept) noexcept
+{
+    const auto kCount = Read<std::uint32_t>(reader);
+    std::vector<GLuint> names(kCount);
+
+    generate(static_cast<GLsizei>(kCount), names.data());
+
+    for (const auto kName : names)
+    {
+        map.names[Read<std::uint32_t>(reader)] = kName;
+    }
+}
+
+///
+/// Destroys objects with the provided function and forgets their recorded names.
+///
+static void DeleteNames(Reader& reader, NameMap& map, void (*destroy)(GLsizei, const GLuint*) noexcept) noexcept
+{
+    const auto kCount = Read<std::uint32_t>(reader);
+    std::vector<GLuint> names(kCount);
+
+    for (auto& name : names)
+    {
+        const auto kRecorded = Read<std::uint32_t>(reader);
+
+        name = map[kRecorded];
+        map.names.erase(kRecorded);
+    }
+
+    destroy(static_cast<GLsizei>(kCount), names.data());
+}
+
+///
+/// \return The location in the replay of a recorded location of the program in use.
+///
+LEPONG_NODISCARD static GLint MapLocation(GLint recorded) noexcept
+{
+    const auto kLocation = sLocations.find((std::uint64_t{ sProgram } << 32u) | static_cast<std::uint32_t>(recorded));
+    return kLocation == sLocations.end() ? recorded : kLocation->second;
+}
+
+bool RunCommand(Reader& reader, Call call) noexcept
+{
+    namespace gl = Graphics::GL;
+
+    const auto kU = [&reader]() { return Read<std::uint32_t>(reader); };
+    const auto kI = [&reader]() { return Read<std::int32_t>(reader); };
+    const auto kF = [&reader]() { return Read<float>(reader); };
+    const auto kQ = [&reader]() { return Read<std::uint64_t>(reader); };
+
+    // Offsets in the bound buffer are passed as pointers.
+    const auto kOffset = [&reader]() { return reinterpret_cast<const void*>(Read<std::uint64_t>(reader)); };
+
+    // Function arguments are evaluated in an unspecified order, every argument is read into a constant first.
+    switch (call)
+    {
+    case Call::FrameEnd:
+        break;
+    case Call::CreateShader:
+    {
+        const auto kType = kU();
+        sObjects.names[kU()] = gl::CreateShader(kType);
+        break;
+    }
+    case Call::DeleteShader:
+        gl::DeleteShader(sObjects[kU()]);
+        break;
+    case Call::ShaderSource:
+    {
+        const auto kShader = sObjects[kU()];
+        const auto kCount = kU();
+
+        std::vector<const GLchar*> strings;
+        std::vector<GLint> lengths;
+
+        for (auto i = 0u; i < kCount && reader.valid; ++i)
+        {
+            const auto kBlob = ReadBlob(reader);
+
+            strings.push_back(static_cast<const GLchar*>(kBlob.data));
+            lengths.push_back(static_cast<GLint>(kBlob.size));
+        }
+
+        gl::ShaderSource(kShader, static_cast<GLsizei>(strings.size()), strings.data(), lengths.data());
+        break;
+    }
+    case Call::CompileShader:
+        gl::CompileShader(sObjects[kU()]);
+        break;
+    case Call::CreateProgram:
+        sObjects.names[kU()] = gl::CreateProgram();
+        break;
+    case Call::DeleteProgram:
+        gl::DeleteProgram(sObjects[kU()]);
+        break;
+    case Call::AttachShader:
+    {
+        const auto kProgram = sObjects[kU()];
+        gl::AttachShader(kProgram, sObjects[kU()]);
+        break;
+    }
+    case Call::LinkProgram:
+        gl::LinkProgram(sObjects[kU()]);
+        break;
+    case Call::UseProgram:
+        sProgram = kU();
+        gl::UseProgram(sObjects[sProgram]);
+        break;
+    case Call::GenVertexArrays:
+        GenerateNames(reader, sVertexArrays, gl::GenVertexArrays);
+        break;
+    case Call::DeleteVertexArrays:
+        DeleteNames(reader, sVertexArrays, gl::DeleteVertexArrays);
+        break;
+    case Call::BindVertexArray:
+        gl::BindVertexArray(sVertexArrays[kU()]);
+        break;
+    case Call::GenBuffers:
+        GenerateNames(reader, sBuffers, gl::GenBuffers);
+        break;
+    case Call::DeleteBuffers:
+        DeleteNames(reader, sBuffers, gl::DeleteBuffers);
+        break;
+    case Call::BindBuffer:
+    {
+        const auto kTarget = kU();
+        gl::BindBuffer(kTarget, sBuffers[kU()]);
+        break;
+    }
+    case Call::BufferData:
+    {
+        const auto kTarget = kU();
+        const auto kSize = kQ();
+        const auto kData = ReadBlob(reader);
+        const auto kUsage = kU();
+
+        gl::BufferData(kTarget, static_cast<GLsizeiptr>(kSize), kData.data, kUsage);
+        break;
+    }
+    case Call::BufferSubData:
+    {
+        const auto kTarget = kU();
+        const auto kBufferOffset = kQ();
+        const auto kData = ReadBlob(reader);
+
+        gl::BufferSubData(kTarget, static_cast<GLsizeiptr>(kBufferOffset), kData.size, kData.data);
+        break;
+    }
+    case Call::EnableVertexAttribArray:
+        gl::EnableVertexAttribArray(kU());
+        break;
+    case Call::VertexAttribPointer:
+    {
+        const auto kIndex = kU();
+        const auto kSize = kI();
+        const auto kType = kU();
+        const auto kNormalized = Read<GLboolean>(reader);
+        const auto kStride = kI();
+
+        gl::VertexAttribPointer(kIndex, kSize, kType, kNormalized, kStride, kOffset());
+        break;
+    }
+    case Call::VertexAttribDivisor:
+    {
+        const auto kIndex = kU();
+        gl::VertexAttribDivisor(kIndex, kU());
+        break;
+    }
+    case Call::DrawElements:
+    {
+        const auto kMode = kU();
+        const auto kCount = kI();
+        const auto kType = kU();
+
+        gl::DrawElements(kMode, kCount, kType, kOffset());
+        break;
+    }
+    case Call::DrawElementsInstanced:
+    {
+        const auto kMode = kU();
+        const auto kCount = kI();
+        const auto kType = kU();
+        const auto kIndices = kOffset();
+
+        gl::DrawElementsInstanced(kMode, kCount, kType, kIndices, kI());
+        break;
+    }
+    case Call::DrawArrays:
+    {
+        const auto kMode = kU();
+        const auto kFirst = kI();
+
+        gl::DrawArrays(kMode, kFirst, kI());
+        break;
+    }
+    case Call::GenTextures:
+        GenerateNames(reader, sTextures, gl::GenTextures);
+        break;
+    case Call::DeleteTextures:
+        DeleteNames(reader, sTextures, gl::DeleteTextures);
+        break;
+    case Call::BindTexture:
+    {
+        const auto kTarget = kU();
+        gl::BindTexture(kTarget, sTextures[kU()]);
+        break;
+    }
+    case Call::ActiveTexture:
+        gl::ActiveTexture(kU());
+        break;
+    case Call::TexImage2D:
+    {
+        const auto kTarget = kU();
+        const auto kLevel = kI();
+        const auto kInternalFormat = kI();
+        const auto kWidth = kI();
+        const auto kHeight = kI();
+        const auto kBorder = kI();
+        const auto kFormat = kU();
+        const auto kType = kU();
+        const auto kData = ReadBlob(reader);
+
+        gl::TexImage2D(kTarget, kLevel, kInternalFormat, kWidth, kHeight, kBorder, kFormat, kType, kData.data);
+        break;
+    }
+    case Call::TexParameteri:
+    {
+        const auto kTarget = kU();
+        const auto kName = kU();
+
+        gl::TexParameteri(kTarget, kName, kI());
+        break;
+    }
+    case Call::GenFramebuffers:
+        GenerateNames(reader, sFramebuffers, gl::GenFramebuffers);
+        break;
+    case Call::DeleteFramebuffers:
+        DeleteNames(reader, sFramebuffers, gl::DeleteFramebuffers);
+        break;
+    case Call::BindFramebuffer:
+    {
+        const auto kTarget = kU();
+        gl::BindFramebuffer(kTarget, sFramebuffers[kU()]);
+        break;
+    }
+    case Call::FramebufferTexture2D:
+    {
+        const auto kTarget = kU();
+        const auto kAttachment = kU();
+        const auto kTextureTarget = kU();
+        const auto kTexture = sTextures[kU()];
+
+        gl::FramebufferTexture2D(kTarget, kAttachment, kTextureTarget, kTexture, kI());
+        break;
+    }
+    case Call::Viewport:
+    {
+        const auto kX = kI();
+        const auto kY = kI();
+        const auto kWidth = kI();
+
+        gl::Viewport(kX, kY, kWidth, kI());
+        break;
+    }
+    case Call::Clear:
+        gl::Clear(kU());
+        break;
+    case Call::GetUniformLocation:
+    {
+        const auto kProgram = kU();
+        const auto kName = ReadBlob(reader);
+        const auto kRecorded = kI();
+
+        // The recorded name isn't null terminated.
+        const std::string kNameString(static_cast<const char*>(kName.data), kName.size);
+        const auto kLocation = gl::GetUniformLocation(sObjects[kProgram], kNameString.c_str());
+
+        sLocations[(std::uint64_t{ kProgram } << 32u) | static_cast<std::uint32_t>(kRecorded)] = kLocation;
+        break;
+    }
+    case Call::Uniform2f:
+    {
+        const auto kLocation = MapLocation(kI());
+        const auto kV0 = kF();
+
+        gl::Uniform2f(kLocation, kV0, kF());
+        break;
+    }
+    case Call::Uniform1i:
+    {
+        const auto kLocation = MapLocation(kI());
+        gl::Uniform1i(kLocation, kI());
+        break;
+    }
+    case Call::Uniform1f:
+    {
+        const auto kLocation = MapLocation(kI());
+        gl::Uniform1f(kLocation, kF());
+        break;
+    }
+    case Call::Uniform4fv:
+    {
+        const auto kLocation = MapLocation(kI());
+        const auto kCount = kI();
+        const auto kValues = ReadBlob(reader);
+
+        // The values may not be aligned in the trace.
+        std::vector<GLfloat> values(kValues.size / sizeof(GLfloat));
+        std::memcpy(values.data(), kValues.data, values.size() * sizeof(GLfloat));
+
+        gl::Uniform4fv(kLocation, kCount, values.data());
+        break;
+    }
+    case Call::GetUniformBlockIndex:
+    {
+        const auto kProgram = kU();
+        const auto kName = ReadBlob(reader);
+        const auto kRecorded = kU();
+
+        const std::string kNameString(static_cast<const char*>(kName.data), kName.size);
+        sBlockIndices[(std::uint64_t{ kProgram } << 32u) | kRecorded] =
+            gl::GetUniformBlockIndex(sObjects[kProgram], kNameString.c_str());
+
+        break;
+    }
+    case Call::UniformBlockBinding:
+    {
+        const auto kProgram = kU();
+        const auto kRecorded = kU();
+
+        // Like locations, an index that was never looked up is passed as is.
+        const auto kIndex = sBlockIndices.find((std::uint64_t{ kProgram } << 32u) | kRecorded);
+        const auto kBlockIndex = kIndex == sBlockIndices.end() ? kRecorded : kIndex->second;
+
+        gl::UniformBlockBinding(sObjects[kProgram], kBlockIndex, kU());
+        break;
+    }
+    case Call::BindBufferBase:
+    {
+        const auto kTarget = kU();
+        const auto kIndex = kU();
+
+        gl::BindBufferBase(kTarget, kIndex, sBuffers[kU()]);
+        break;
+    }
+    default:
+        reader.valid = false;
+        break;
+    }
+
+    return reader.valid;
+}
@@ -0,0 +1,170 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "lepong/Check.h"
+#include "lepong/Log.h"
+#include "lepong/Replay/Query.h"
+
+using namespace lepong;
+
+static constexpr const char* skColumnNames[] =
+{
+    "BlobOffset",
+    "BlobSize",
+    "Seed",
+    "Segment",
+    "NumTicks",
+    "Duration",
+    "Player1Score",
+    "Player2Score",
+    "NumRallies",
+    "NumPaddleHits"
+};
+
+static_assert(std::size(skColumnNames) == static_cast<std::size_t>(Replay::Column::Count));
+
+static constexpr const char* skComparisonNames[] = { "<", "<=", "==", "!=", ">=", ">" };
+
+///
+/// Finds the provided name in the provided table.
+///
+/// \return Whether the name was found.
+///
+template<typename T, std::size_t Size>
+LEPONG_NODISCARD static bool ParseName(const char* const (&names)[Size], const char* name, T& value) noexcept
+{
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        if (std::strcmp(names[i], name) == 0)
+        {
+            value = static_cast<T>(i);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+///
+/// Prints the command line usage.
+///
+static void PrintUsage() noexcept
+{
+    std::puts(
+        "Usage: lepong_query [--rallies <min hits>] [--lost-by <1|2>] [<column> <comparison> <value>]...\n"
+        "\n"
+        "Lists the archived matches passing every column predicate. With --rallies, the matching replays are\n"
+        "re-simulated and every rally with at least <min hits> paddle hits is listed instead.\n"
+        "\n"
+        "Columns: Seed, Segment, NumTicks, Duration, Player1Score, Player2Score, NumRallies, NumPaddleHits.\n"
+        "Comparisons: < <= == != >= >");
+}
+
+///
+/// Fills the query from the command line.
+///
+/// \return Whether the command line was valid.
+///
+LEPONG_NODISCARD static bool ParseQuery(int argc, char** argv, Replay::Query& query) noexcept;
+
+int main(int argc, char** argv)
+{
+    Replay::Query query;
+
+    if (!ParseQuery(argc, argv, query))
+    {
+        PrintUsage();
+        return -1;
+    }
+
+    // The re-simulated matches that diverge from their recording are reported in the log.
+    if (!Log::Init())
+    {
+        std::fputs("Failed to open lepong.log in the current directory\n", stderr);
+        return -1;
+    }
+
+    auto reader = Replay::OpenArchive();
+
+    if (!reader.IsValid())
+    {
+        std::fputs("No replay archive found in the current directory\n", stderr);
+        Log::Cleanup();
+        return -1;
+    }
+
+    const auto kResult = Replay::RunQuery(reader, query);
+
+    if (query.findRallies)
+    {
+        for (const auto& kRally : kResult.rallies)
+        {
+            std::printf(
+                "match %u, rally %u: %u hits, lost by player %d\n",
+                kRally.match, kRally.rally, kRally.numPaddleHits, static_cast<int>(kRally.lostSide) + 1);
+        }
+
+        std::printf(
+            "%zu rallies in %zu re-simulated matches (%u desynced, see lepong.log)\n",
+            kResult.rallies.size(), kResult.matches.size(), kResult.numDesyncedMatches);
+    }
+    else
+    {
+        for (const auto kMatch : kResult.matches)
+        {
+            std::printf(
+                "match %u: %u - %u\n", kMatch,
+                Replay::GetCell<std::uint32_t>(reader, kMatch, Replay::Column::Player1Score),
+                Replay::GetCell<std::uint32_t>(reader, kMatch, Replay::Column::Player2Score));
+        }
+
+        std::printf("%zu of %u matches\n", kResult.matches.size(), Replay::GetNumMatches(reader));
+    }
+
+    Replay::CloseArchive(reader);
+    Log::Cleanup();
+}
+
+bool ParseQuery(int argc, char** argv, Replay::Query& query) noexcept
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const auto kArgument = argv[i];
+        const auto kHasValue = i + 1 < argc;
+
+        if (std::strcmp(kArgument, "--rallies") == 0 && kHasValue)
+        {
+            query.findRallies = true;
+            query.rallyPredicate.minPaddleHits = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (std::strcmp(kArgument, "--lost-by") == 0 && kHasValue)
+        {
+            const auto kPlayer = std::atoi(argv[++i]);
+            LEPONG_CHECK_OR_RETURN_VAL(kPlayer == 1 || kPlayer == 2, false);
+
+            query.rallyPredicate.lostSide = static_cast<Side>(kPlayer - 1);
+        }
+        else if (i + 2 < argc)
+        {
+            Replay::ColumnPredicate predicate;
+
+            LEPONG_CHECK_OR_RETURN_VAL(ParseName(skColumnNames, argv[i], predicate.column), false);
+            LEPONG_CHECK_OR_RETURN_VAL(ParseName(skComparisonNames, argv[i + 1], predicate.comparison), false);
+            predicate.value = std::strtod(argv[i + 2], nullptr);
+
+            query.columnPredicates.push_back(predicate);
+            i += 2;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,189 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <cstdio>
+#include <cstring>
+#include <Windows.h>
+
+#include "lepong/Check.h"
+#include "lepong/FileMapping.h"
+#include "lepong/Metrics/Metrics.h"
+
+using namespace lepong;
+
+static constexpr DWORD skRefreshPeriod = 1000u; // In milliseconds.
+
+///
+/// What a slot looked like at the previous refresh, to show rates and recent percentiles.
+///
+struct SlotSnapshot
+{
+    std::uint32_t processId = 0u;
+    std::uint64_t time = 0u;
+
+    std::uint64_t numFrames = 0u;
+    std::uint64_t numTicks = 0u;
+    std::uint64_t numMatches = 0u;
+
+    Time::Histogram frameTimes;
+    Time::Histogram tickTimes;
+};
+
+static SlotSnapshot sSnapshots[Metrics::skMaxInstances];
+
+///
+/// Copies the provided histogram.
+///
+static void CopyHistogram(Time::Histogram& into, const Time::Histogram& from) noexcept;
+
+///
+/// Computes the histogram of the values recorded between two copies of the same histogram.
+///
+static void SubtractHistogram(Time::Histogram& into, const Time::Histogram& current, const Time::Histogram& previous) noexcept;
+
+///
+/// Prints the provided slot's line and updates its snapshot.
+///
+static void PrintSlot(const Metrics::InstanceMetrics& slot, SlotSnapshot& snapshot, std::uint64_t now) noexcept;
+
+int main(int argc, char** argv)
+{
+    const auto kOnce = argc > 1 && std::strcmp(argv[1], "--once") == 0;
+
+    char path[MAX_PATH];
+    Metrics::GetRegionPath(path, sizeof(path));
+
+    auto mapping = FileMapping::MakeReadOnlyMapping(path);
+
+    if (!mapping.IsValid() || mapping.size < sizeof(Metrics::Region))
+    {
+        std::fprintf(stderr, "No metrics region found at %s, is lepong running?\n", path);
+        return -1;
+    }
+
+    const auto& kRegion = *static_cast<const Metrics::Region*>(mapping.data);
+
+    if (kRegion.magic.load() != Metrics::skRegionMagic || kRegion.version != Metrics::skRegionVersion)
+    {
+        std::fprintf(stderr, "The metrics region at %s has an unknown layout\n", path);
+        FileMapping::DestroyMapping(mapping);
+        return -1;
+    }
+
+    for (;;)
+    {
+        const auto kNow = Metrics::GetHeartbeatTime();
+
+        // Clears the console, the first refresh only shows totals.
+        std::fputs("\x1b[H\x1b[2J", stdout);
+        std::printf(
+            "%8s %8s %10s %10s %10s %10s %10s %7s\n",
+            "PID", "FPS", "frame p50", "frame p99", "tick p50", "tick p99", "matches/s", "score");
+
+        for (unsigned i = 0; i < Metrics::skMaxInstances; ++i)
+        {
+            PrintSlot(kRegion.slots[i], sSnapshots[i], kNow);
+        }
+
+        std::fflush(stdout);
+
+        if (kOnce)
+        {
+            break;
+        }
+
+        Sleep(skRefreshPeriod);
+    }
+
+    FileMapping::DestroyMapping(mapping);
+}
+
+void CopyHistogram(Time::Histogram& into, const Time::Histogram& from) noexcept
+{
+    Time::ResetHistogram(into);
+    Time::MergeHistogram(into, from);
+}
+
+void SubtractHistogram(Time::Histogram& into, const Time::Histogram& current, const Time::Histogram& previous) noexcept
+{
+    for (unsigned i = 0; i < Time::skNumHistogramBuckets; ++i)
+    {
+        const auto kCount = current.counts[i].load(std::memory_order_relaxed);
+        into.counts[i].store(kCount - previous.counts[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    const auto kTotalCount = current.totalCount.load() - previous.totalCount.load();
+    into.totalCount.store(kTotalCount, std::memory_order_relaxed);
+    into.sum.store(current.sum.load() - previous.sum.load(), std::memory_order_relaxed);
+
+    // Bounds can't be subtracted, the overall ones still cap the percentiles correctly.
+    into.min.store(current.min.load(), std::memory_order_relaxed);
+    into.max.store(current.max.load(), std::memory_order_relaxed);
+}
+
+///
+/// Scratch histogram for the values recorded since the previous refresh.
+///
+static Time::Histogram sRecent;
+
+///
+/// \return The provided percentile of the values recorded since the previous refresh, in milliseconds.
+///
+LEPONG_NODISCARD static double GetRecentPercentile(
+    const Time::Histogram& current, const Time::Histogram& previous, double percentile) noexcept
+{
+    SubtractHistogram(sRecent, current, previous);
+    return static_cast<double>(Time::GetValueAtPercentile(sRecent, percentile)) / 1e6;
+}
+
+void PrintSlot(const Metrics::InstanceMetrics& slot, SlotSnapshot& snapshot, std::uint64_t now) noexcept
+{
+    const auto kProcessId = slot.processId.load();
+    const auto kAlive = kProcessId != 0u && now - slot.heartbeat.load() <= Metrics::skHeartbeatTimeout;
+
+    LEPONG_CHECK_OR_RETURN(kAlive);
+
+    const auto kNumFrames = slot.numFrames.load(std::memory_order_relaxed);
+    const auto kNumTicks = slot.numTicks.load(std::memory_order_relaxed);
+    const auto kNumMatches = slot.numMatches.load(std::memory_order_relaxed);
+
+    if (snapshot.processId == kProcessId && now > snapshot.time)
+    {
+        const auto kSeconds = static_cast<double>(now - snapshot.time) / 1000.0;
+
+        std::printf(
+            "%8u %8.1f %8.2fms %8.2fms %8.3fms %8.3fms %10.2f %3u - %u\n",
+            kProcessId,
+            static_cast<double>(kNumFrames - snapshot.numFrames) / kSeconds,
+            GetRecentPercentile(slot.frameTimes, snapshot.frameTimes, 50.0),
+            GetRecentPercentile(slot.frameTimes, snapshot.frameTimes, 99.0),
+            GetRecentPercentile(slot.tickTimes, snapshot.tickTimes, 50.0),
+            GetRecentPercentile(slot.tickTimes, snapshot.tickTimes, 99.0),
+            static_cast<double>(kNumMatches - snapshot.numMatches) / kSeconds,
+            slot.playerScores[0].load(std::memory_order_relaxed),
+            slot.playerScores[1].load(std::memory_order_relaxed));
+    }
+    else
+    {
+        std::printf(
+            "%8u %8s %8.2fms %8.2fms %8.3fms %8.3fms %10s %3u - %u\n",
+            kProcessId, "-",
+            static_cast<double>(Time::GetValueAtPercentile(slot.frameTimes, 50.0)) / 1e6,
+            static_cast<double>(Time::GetValueAtPercentile(slot.frameTimes, 99.0)) / 1e6,
+            static_cast<double>(Time::GetValueAtPercentile(slot.tickTimes, 50.0)) / 1e6,
+            static_cast<double>(Time::GetValueAtPercentile(slot.tickTimes, 99.0)) / 1e6,
+            "-",
+            slot.playerScores[0].load(std::memory_order_relaxed),
+            slot.playerScores[1].load(std::memory_order_relaxed));
+    }
+
+    snapshot.processId = kProcessId;
+    snapshot.time = now;
+    snapshot.numFrames = kNumFrames;
+    snapshot.numTicks = kNumTicks;
+    snapshot.numMatches = kNumMatches;
+
+    CopyHistogram(snapshot.frameTimes, slot.frameTimes);
+    CopyHistogram(snapshot.tickTimes, slot.tickTimes);
+}
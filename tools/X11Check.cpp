@@ -0,0 +1,146 @@
+//
+// Created by lepouki on 10/17/2026.
+//
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "lepong/Check.h"
+#include "lepong/Window.h"
+#include "lepong/Graphics/GL.h"
+
+using namespace lepong;
+
+namespace gl = Graphics::GL;
+
+// Opens a window with an OpenGL context through the X11 backend, then clears and swaps it for a number of frames while
+// polling its events. Meant for headless X servers such as Xvfb:
+//     xvfb-run -s "-screen 0 1280x720x24" lepong_x11check [frames]
+// Key and resize events are printed as they come, a key pressed with xdotool should be printed once until released.
+// A passing run prints the OpenGL version and renderer, then the number of frames rendered, and exits with 0. An X
+// error, such as a window whose visual doesn't match the framebuffer configuration, ends it through Xlib's handler.
+
+static constexpr int skDefaultNumFrames = 120;
+
+///
+/// Prints the key events.
+///
+static void OnKeyEvent(int key, bool pressed) noexcept;
+
+///
+/// Prints the resize events.
+///
+static void OnResizeEvent(const Vector2i& size) noexcept;
+
+///
+/// Clears and swaps the window for the provided number of frames, or until it is closed.
+///
+/// \return Whether every frame was rendered.
+///
+LEPONG_NODISCARD static bool Run(const gl::Context& context, int numFrames) noexcept;
+
+int main(int argc, char** argv)
+{
+    const auto kNumFrames = argc > 1 ? std::atoi(argv[1]) : skDefaultNumFrames;
+
+    if (kNumFrames <= 0 || !Log::Init())
+    {
+        std::fprintf(stderr, "Usage: lepong_x11check [frames]\n");
+        return -1;
+    }
+
+    if (!Window::Init())
+    {
+        std::fprintf(stderr, "Failed to open the X display, is DISPLAY set?\n");
+        Log::Cleanup();
+        return -1;
+    }
+
+    Window::SetKeyCallback(OnKeyEvent);
+    Window::SetResizeCallback(OnResizeEvent);
+
+    const auto kWindow = Window::MakeWindow({ 640, 480 }, L"lepong X11 check");
+    auto result = -1;
+
+    if (gl::Init())
+    {
+        const auto kContext = gl::MakeContext(kWindow);
+
+        if (kContext.IsValid())
+        {
+            gl::MakeContextCurrent(kContext);
+
+            std::printf(
+                "%s\n%s\n",
+                reinterpret_cast<const char*>(gl::GetString(gl::Version)),
+                reinterpret_cast<const char*>(gl::GetString(gl::Renderer)));
+
+            Window::ShowWindow(kWindow);
+            result = Run(kContext, kNumFrames) ? 0 : -1;
+
+            gl::DestroyContext(kContext);
+        }
+        else
+        {
+            std::fprintf(stderr, "Failed to create an OpenGL context, see lepong.log\n");
+        }
+
+        gl::Cleanup();
+    }
+
+    Window::DestroyWindow(kWindow);
+    Window::Cleanup();
+    Log::Cleanup();
+
+    return result;
+}
+
+void OnKeyEvent(int key, bool pressed) noexcept
+{
+    std::printf("Key 0x%02X %s\n", key, pressed ? "pressed" : "released");
+}
+
+void OnResizeEvent(const Vector2i& size) noexcept
+{
+    std::printf("Resized to %dx%d\n", size.x, size.y);
+    gl::Viewport(0, 0, size.x, size.y);
+}
+
+bool Run(const gl::Context& context, int numFrames) noexcept
+{
+    using Clock = std::chrono::steady_clock;
+
+    Clock::duration totalPollTime = {};
+    Clock::duration maxPollTime = {};
+
+    int frame = 0;
+
+    for (; frame < numFrames; ++frame)
+    {
+        const auto kPollStart = Clock::now();
+        const auto kKeepRunning = Window::PollEvents();
+        const auto kPollTime = Clock::now() - kPollStart;
+
+        totalPollTime += kPollTime;
+        maxPollTime = kPollTime > maxPollTime ? kPollTime : maxPollTime;
+
+        if (!kKeepRunning)
+        {
+            break;
+        }
+
+        gl::Clear(gl::ColorBufferBit);
+        gl::SwapBuffers(context);
+    }
+
+    using Microseconds = std::chrono::duration<double, std::micro>;
+
+    std::printf(
+        "%d frames, event polling took %.1f us on average and %.1f us at most\n",
+        frame,
+        Microseconds(totalPollTime).count() / (frame > 0 ? frame : 1),
+        Microseconds(maxPollTime).count());
+
+    return frame == numFrames;
+}